@@ -0,0 +1,45 @@
+#ifndef ARMY_HPP
+# define ARMY_HPP
+
+#include <string>
+#include <vector>
+
+#include "WeaponRegistry.hpp"
+
+/*
+ * Structure-of-arrays storage for many HumanA/HumanB: names live back to
+ * back in one arena and the weapon of human i is _weapons[i] (NO_WEAPON
+ * for an unarmed HumanB), so a sweep only walks two flat arrays.
+ */
+class Army {
+
+	private:
+		const WeaponRegistry&		_registry;
+		std::vector<char>			_names;
+		std::vector<size_t>			_nameOffsets;	// size() + 1 entries
+		std::vector<WeaponHandle>	_weapons;
+
+		size_t		_add(const std::string& name, WeaponHandle weapon);
+		void		_appendAttack(size_t index, std::string& out) const;
+
+		Army(const Army& copy);
+		Army&	operator=(const Army& src);
+
+	public:
+		Army(const WeaponRegistry& registry);
+		~Army(void);
+
+		size_t		addHumanA(const std::string& name, WeaponHandle weapon);
+		size_t		addHumanB(const std::string& name);
+		void		setWeapon(size_t index, WeaponHandle weapon);
+		void		reserve(size_t humans, size_t nameBytes);
+
+		size_t		size(void) const;
+		std::string	getName(size_t index) const;
+
+		void		attack(size_t index) const;
+		void		attackAll(std::string& out) const;
+		void		countAttacks(std::vector<size_t>& perWeapon, size_t& unarmed) const;
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef WEAPONREGISTRY_HPP
+# define WEAPONREGISTRY_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+
+typedef unsigned int	WeaponHandle;
+
+# define NO_WEAPON	((WeaponHandle)-1)
+
+/*
+ * Interns weapon types: every distinct type string is stored once and
+ * referred to by a 32-bit handle. A handle plays the role of the Weapon&
+ * of HumanA: retyping it is seen by everyone holding it.
+ */
+class WeaponRegistry {
+
+	private:
+		std::vector<std::string>				_types;
+		std::map<std::string, WeaponHandle>		_handles;
+
+		WeaponRegistry(const WeaponRegistry& copy);
+		WeaponRegistry&	operator=(const WeaponRegistry& src);
+
+	public:
+		WeaponRegistry(void);
+		~WeaponRegistry(void);
+
+		WeaponHandle		intern(const std::string& type);
+		const std::string&	getType(WeaponHandle handle) const;
+		void				setType(WeaponHandle handle, const std::string& type);
+		size_t				size(void) const;
+};
+
+#endif
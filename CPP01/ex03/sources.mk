@@ -4,7 +4,9 @@ override SRCS		= $(addprefix $(SRCSDIR), $(SRC))
 SRC	+= $(addsuffix .cpp, $(MAIN))
 
 override MAIN			:= \
+	Army \
 	HumanA \
 	HumanB \
 	main \
-	Weapon
+	Weapon \
+	WeaponRegistry
@@ -0,0 +1,107 @@
+#include <iostream>
+
+#include "Army.hpp"
+
+Army::Army(const WeaponRegistry& registry) : _registry(registry)
+{
+	this->_nameOffsets.push_back(0);
+}
+
+Army::~Army(void) {}
+
+void	Army::reserve(size_t humans, size_t nameBytes)
+{
+	this->_names.reserve(nameBytes);
+	this->_nameOffsets.reserve(humans + 1);
+	this->_weapons.reserve(humans);
+}
+
+size_t	Army::_add(const std::string& name, WeaponHandle weapon)
+{
+	this->_names.insert(this->_names.end(), name.begin(), name.end());
+	this->_nameOffsets.push_back(this->_names.size());
+	this->_weapons.push_back(weapon);
+	return (this->_weapons.size() - 1);
+}
+
+/* Like HumanA, always armed */
+size_t	Army::addHumanA(const std::string& name, WeaponHandle weapon)
+{
+	return (this->_add(name, weapon));
+}
+
+/* Like HumanB, unarmed until setWeapon() */
+size_t	Army::addHumanB(const std::string& name)
+{
+	return (this->_add(name, NO_WEAPON));
+}
+
+void	Army::setWeapon(size_t index, WeaponHandle weapon)
+{
+	this->_weapons[index] = weapon;
+}
+
+size_t	Army::size(void) const
+{
+	return (this->_weapons.size());
+}
+
+std::string	Army::getName(size_t index) const
+{
+	const char*	names = this->_names.empty() ? "" : &this->_names[0];
+
+	return (std::string(names + this->_nameOffsets[index], names + this->_nameOffsets[index + 1]));
+}
+
+
+
+/* Attacks */
+
+void	Army::_appendAttack(size_t index, std::string& out) const
+{
+	const char*	names = this->_names.empty() ? "" : &this->_names[0];
+
+	out.append(names + this->_nameOffsets[index], names + this->_nameOffsets[index + 1]);
+	if (this->_weapons[index] == NO_WEAPON)
+		out += " punches with both fists\n";
+	else
+	{
+		out += " attacks with their ";
+		out += this->_registry.getType(this->_weapons[index]);
+		out += '\n';
+	}
+}
+
+void	Army::attack(size_t index) const
+{
+	std::string	line;
+
+	this->_appendAttack(index, line);
+	std::cout << line << std::flush;
+}
+
+/* One linear pass over the arena and the handle array, text appended to out */
+void	Army::attackAll(std::string& out) const
+{
+	if (this->_weapons.empty())
+		return ;
+	for (size_t i = 0; i < this->_weapons.size(); i++)
+		this->_appendAttack(i, out);
+}
+
+/* Same sweep without text: how many attacks each weapon type gets */
+void	Army::countAttacks(std::vector<size_t>& perWeapon, size_t& unarmed) const
+{
+	const WeaponHandle*	weapons = this->_weapons.empty() ? NULL : &this->_weapons[0];
+	size_t				count = this->_weapons.size();
+
+	perWeapon.assign(this->_registry.size(), 0);
+	unarmed = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (weapons[i] == NO_WEAPON)
+			unarmed++;
+		else
+			perWeapon[weapons[i]]++;
+	}
+}
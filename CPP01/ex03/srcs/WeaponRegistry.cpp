@@ -0,0 +1,40 @@
+#include "WeaponRegistry.hpp"
+
+WeaponRegistry::WeaponRegistry(void) {}
+
+WeaponRegistry::~WeaponRegistry(void) {}
+
+WeaponHandle	WeaponRegistry::intern(const std::string& type)
+{
+	std::map<std::string, WeaponHandle>::iterator	it = this->_handles.find(type);
+
+	if (it != this->_handles.end())
+		return (it->second);
+
+	WeaponHandle	handle = this->_types.size();
+
+	this->_types.push_back(type);
+	this->_handles[type] = handle;
+	return (handle);
+}
+
+const std::string&	WeaponRegistry::getType(WeaponHandle handle) const
+{
+	return (this->_types[handle]);
+}
+
+void	WeaponRegistry::setType(WeaponHandle handle, const std::string& type)
+{
+	std::map<std::string, WeaponHandle>::iterator	it = this->_handles.find(this->_types[handle]);
+
+	if (it != this->_handles.end() && it->second == handle)
+		this->_handles.erase(it);
+	this->_types[handle] = type;
+	if (this->_handles.find(type) == this->_handles.end())
+		this->_handles[type] = handle;
+}
+
+size_t	WeaponRegistry::size(void) const
+{
+	return (this->_types.size());
+}
@@ -1,9 +1,74 @@
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <ctime>
+
 #include "Weapon.hpp"
 #include "HumanA.hpp"
 #include "HumanB.hpp"
+#include "Army.hpp"
 
-int main()
+static double	elapsedMs(clock_t start)
 {
+	return ((double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC);
+}
+
+/* ./violence --mass <humans>: the same duel, but for a whole army */
+static int	massCombat(long humans)
+{
+	WeaponRegistry	registry;
+	Army			army(registry);
+	const char*		types[4] = {"crude spiked club", "rusty sword", "wooden spoon", "crude spiked club"};
+	clock_t			start = clock();
+
+	army.reserve(humans, humans * 8);
+	for (long i = 0; i < humans; i++)
+	{
+		std::ostringstream	name;
+
+		name << (i % 2 ? "Jim" : "Bob") << i;
+		if (i % 2)
+		{
+			size_t	index = army.addHumanB(name.str());
+			if (i % 3)
+				army.setWeapon(index, registry.intern(types[i % 4]));
+		}
+		else
+			army.addHumanA(name.str(), registry.intern(types[i % 4]));
+	}
+	std::cout << "built " << army.size() << " humans, " << registry.size()
+		<< " weapon types in " << elapsedMs(start) << " ms" << std::endl;
+
+	std::vector<size_t>	perWeapon;
+	size_t				unarmed;
+
+	start = clock();
+	army.countAttacks(perWeapon, unarmed);
+	std::cout << "count sweep: " << elapsedMs(start) << " ms" << std::endl;
+	for (size_t i = 0; i < perWeapon.size(); i++)
+		std::cout << "  " << registry.getType(i) << ": " << perWeapon[i] << std::endl;
+	std::cout << "  fists: " << unarmed << std::endl;
+
+	std::string	out;
+
+	registry.setType(registry.intern("wooden spoon"), "some other type of spoon");
+	start = clock();
+	out.reserve(army.size() * 48);
+	army.attackAll(out);
+	std::cout << "attack sweep: " << elapsedMs(start) << " ms, " << out.size() << " bytes of text" << std::endl;
+	army.attack(army.size() - 1);
+	return (0);
+}
+
+int main(int ac, char **av)
+{
+	if (ac == 3 && std::string(av[1]) == "--mass")
+		return (massCombat(std::atol(av[2]) > 0 ? std::atol(av[2]) : 1));
+	if (ac > 1)
+	{
+		std::cerr << "usage: " << av[0] << " [--mass <humans>]" << std::endl;
+		return (1);
+	}
 	{
 		Weapon club = Weapon("crude spiked club");
 		HumanA bob("Bob", club);
@@ -0,0 +1,63 @@
+#ifndef ASYNCLOGGER_HPP
+# define ASYNCLOGGER_HPP
+
+# include <iostream>
+# include <pthread.h>
+
+# include "LogQueue.hpp"
+
+# define LOG_BATCH_SIZE		512
+
+/*
+ * What push() does when the queue is full:
+ *  - BLOCK: the caller yields until the writer frees a cell, nothing is lost
+ *  - DROP:  the record is discarded silently (still counted by dropped())
+ *  - COUNT: the record is discarded and the writer inserts a
+ *           "[HARL] N records dropped" line in the output where the gap is
+ */
+typedef enum overflowPolicy
+{
+	OVERFLOW_BLOCK,
+	OVERFLOW_DROP,
+	OVERFLOW_COUNT
+}	e_overflowPolicy;
+
+class	AsyncLogger
+{
+	private:
+		LogQueue			_queue;
+		e_overflowPolicy	_policy;
+		std::ostream&		_out;
+		pthread_t			_writer;
+
+		int					_running;
+		size_t				_producers;	// log() calls in flight, see stop()
+		size_t				_dropped;
+		size_t				_reported;	// writer side: drops already announced
+		size_t				_written;
+		size_t				_batches;
+
+		static void*	_writerRoutine(void* self);
+		size_t			_writeBatch(LogRecord* batch, std::string& buffer);
+		void			_drain(void);
+
+		AsyncLogger(const AsyncLogger& copy);
+		AsyncLogger&	operator=(const AsyncLogger& src);
+
+	public:
+		AsyncLogger(size_t capacity = 4096,
+			e_overflowPolicy policy = OVERFLOW_BLOCK,
+			std::ostream& out = std::cout);
+		~AsyncLogger(void);
+
+		bool	log(int level, const char* message);
+		void	stop(void);
+
+		size_t	dropped(void) const;
+		size_t	written(void) const;
+		size_t	batches(void) const;
+
+		static const char*	levelName(int level);
+};
+
+#endif
@@ -3,23 +3,94 @@
 
 # include <string>
 
+# include "AsyncLogger.hpp"
+# include "BinaryLogger.hpp"
+
+/*
+ * Minimum level compiled in, e.g. -DHARL_MIN_LEVEL=HARL_WARNING: every
+ * say<Level>() below it instantiates an empty inline function and vanishes.
+ * With -DHARL_RUNTIME_LEVEL everything is compiled in and the threshold is
+ * read from Harl::setRuntimeLevel() instead (one compare per call).
+ * complain(), and so the binary and filter modes, obey the same threshold
+ * through _enabled(), with a compare instead of an empty function.
+ */
+# ifndef HARL_MIN_LEVEL
+#  define HARL_MIN_LEVEL	HARL_DEBUG
+# endif
+
+# ifdef HARL_RUNTIME_LEVEL
+#  define HARL_COMPILED_LEVEL	HARL_DEBUG
+# else
+#  define HARL_COMPILED_LEVEL	HARL_MIN_LEVEL
+# endif
+
+template <bool Enabled>
+struct	HarlGate;
+
 class Harl {
 
 	private:
 
 		void	(Harl::*_memberFunctions[5])(void);
+		AsyncLogger*	_logger;
+		BinaryLogger*	_binary;
 
 		void	debug(void);
 		void	info(void);
 		void	warning(void);
 		void	error(void);
 		void	other(void);
+
+		void	_emit(int level);
+		void	_complainAt(int level);
+		void	_initMemberFunctions(void);
+
+		static int		_runtimeLevel;
+
+		static bool		_enabled(int level);
+
+		template <bool Enabled>
+		friend struct	HarlGate;
 	public:
 
 		Harl(void);
+		Harl(AsyncLogger& logger);
+		Harl(BinaryLogger& binary);
 		~Harl(void);
 
 		void	complain(std::string level);
+
+		template <int Level>
+		void	say(void);
+
+		static const char*	message(int level);
+		static void			setRuntimeLevel(int level);
+		static int			runtimeLevel(void);
+};
+
+template <>
+struct	HarlGate<false>
+{
+	static void	emit(Harl&, int) {}
 };
 
+template <>
+struct	HarlGate<true>
+{
+	static void	emit(Harl& harl, int level)
+	{
+# ifdef HARL_RUNTIME_LEVEL
+		if (level < Harl::_runtimeLevel)
+			return ;
+# endif
+		harl._emit(level);
+	}
+};
+
+template <int Level>
+void	Harl::say(void)
+{
+	HarlGate<(Level >= HARL_COMPILED_LEVEL)>::emit(*this, Level);
+}
+
 #endif
@@ -0,0 +1,59 @@
+#ifndef LOGQUEUE_HPP
+# define LOGQUEUE_HPP
+
+# include <cstddef>
+
+# define LOG_CACHE_LINE	64
+
+typedef enum harlLevel
+{
+	HARL_DEBUG,
+	HARL_INFO,
+	HARL_WARNING,
+	HARL_ERROR,
+	HARL_OTHER
+}	e_harlLevel;
+
+struct	LogRecord
+{
+	int			level;
+	const char*	message;	// Harl only logs string literals, no copy needed
+};
+
+/*
+ * Bounded multi-producer / single-consumer queue (Vyukov style).
+ * Every cell carries a sequence number telling whether it is free for the
+ * producer of a given ticket or ready for the consumer, so neither side
+ * ever takes a lock. Capacity is rounded up to a power of two.
+ */
+class	LogQueue
+{
+	private:
+		struct	Cell
+		{
+			size_t		sequence;
+			LogRecord	record;
+		};
+
+		Cell*		_cells;
+		size_t		_mask;
+		char		_pad0[LOG_CACHE_LINE];
+		size_t		_enqueuePos;
+		char		_pad1[LOG_CACHE_LINE];
+		size_t		_dequeuePos;
+		char		_pad2[LOG_CACHE_LINE];
+
+		LogQueue(const LogQueue& copy);
+		LogQueue&	operator=(const LogQueue& src);
+
+	public:
+		LogQueue(size_t capacity);
+		~LogQueue(void);
+
+		bool	push(const LogRecord& record);
+		size_t	popBatch(LogRecord* out, size_t max);
+
+		size_t	capacity(void) const;
+};
+
+#endif
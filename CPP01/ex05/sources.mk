@@ -1,8 +1,22 @@
 override SRCSDIR	:= srcs/
 override SRCS		= $(addprefix $(SRCSDIR), $(SRC))
+override DECODER_SRCS	= $(addprefix $(SRCSDIR), $(DECODER_SRC))
+override BENCH_SRCS		= $(addprefix $(SRCSDIR), $(addsuffix .cpp, $(LIB) $(BENCH_MAIN)))
 
-SRC	+= $(addsuffix .cpp, $(MAIN))
+SRC	+= $(addsuffix .cpp, $(LIB) $(MAIN))
+DECODER_SRC	+= $(addsuffix .cpp, $(LIB) $(DECODER_MAIN))
 
-override MAIN			:= \
+override LIB			:= \
+	AsyncLogger \
+	BinaryLogger \
 	Harl \
+	LogQueue \
+
+override MAIN			:= \
 	main \
+
+override DECODER_MAIN	:= \
+	harlDecode \
+
+override BENCH_MAIN		:= \
+	bench \
@@ -0,0 +1,159 @@
+#include <sstream>
+#include <unistd.h>
+#include <sched.h>
+
+#include "AsyncLogger.hpp"
+
+AsyncLogger::AsyncLogger(size_t capacity, e_overflowPolicy policy, std::ostream& out)
+	: _queue(capacity), _policy(policy), _out(out), _running(1), _producers(0),
+	_dropped(0), _reported(0), _written(0), _batches(0)
+{
+	if (pthread_create(&this->_writer, NULL, &AsyncLogger::_writerRoutine, this) != 0)
+	{
+		std::cerr << "AsyncLogger: cannot start writer thread" << std::endl;
+		this->_running = 0;
+	}
+}
+
+AsyncLogger::~AsyncLogger(void)
+{
+	this->stop();
+}
+
+/*
+ * Joins the writer, waits for the log() calls that saw it running, then
+ * drains what they pushed: every log() call ends up either written or
+ * counted by dropped(), and the ones after stop() are dropped.
+ */
+void	AsyncLogger::stop(void)
+{
+	if (!__atomic_exchange_n(&this->_running, 0, __ATOMIC_SEQ_CST))
+		return ;
+	pthread_join(this->_writer, NULL);
+	while (__atomic_load_n(&this->_producers, __ATOMIC_SEQ_CST) != 0)
+		sched_yield();
+	this->_drain();
+}
+
+
+
+/* Producer side */
+
+bool	AsyncLogger::log(int level, const char* message)
+{
+	LogRecord	record;
+
+	record.level = level;
+	record.message = message;
+
+	// announced before looking at _running: stop() then either sees us or we see it
+	__atomic_add_fetch(&this->_producers, 1, __ATOMIC_SEQ_CST);
+	bool	pushed = __atomic_load_n(&this->_running, __ATOMIC_SEQ_CST) != 0;
+
+	while (pushed && !this->_queue.push(record))
+	{
+		if (this->_policy != OVERFLOW_BLOCK || !__atomic_load_n(&this->_running, __ATOMIC_ACQUIRE))
+			pushed = false;
+		else
+			sched_yield();
+	}
+	if (!pushed)
+		__atomic_add_fetch(&this->_dropped, 1, __ATOMIC_RELAXED);
+	__atomic_sub_fetch(&this->_producers, 1, __ATOMIC_RELEASE);
+	return (pushed);
+}
+
+
+
+/* Writer side */
+
+const char*	AsyncLogger::levelName(int level)
+{
+	static const char*	names[5] = {"DEBUG", "INFO", "WARNING", "ERROR", "OTHER"};
+
+	if (level < HARL_DEBUG || level > HARL_OTHER)
+		return (names[HARL_OTHER]);
+	return (names[level]);
+}
+
+size_t	AsyncLogger::_writeBatch(LogRecord* batch, std::string& buffer)
+{
+	size_t	count = this->_queue.popBatch(batch, LOG_BATCH_SIZE);
+
+	buffer.clear();
+	if (this->_policy == OVERFLOW_COUNT)
+	{
+		size_t	dropped = __atomic_load_n(&this->_dropped, __ATOMIC_RELAXED);
+
+		if (dropped != this->_reported)
+		{
+			std::ostringstream	line;
+
+			line << "[HARL] " << dropped - this->_reported << " records dropped\n";
+			buffer += line.str();
+			this->_reported = dropped;
+		}
+	}
+	for (size_t i = 0; i < count; i++)
+	{
+		buffer += '[';
+		buffer += levelName(batch[i].level);
+		buffer += "] ";
+		buffer += batch[i].message;
+		buffer += '\n';
+	}
+	if (!buffer.empty())
+	{
+		this->_out.write(buffer.data(), buffer.size());
+		this->_out.flush();		// one flush per batch instead of one per line
+		__atomic_add_fetch(&this->_written, count, __ATOMIC_RELAXED);
+		__atomic_add_fetch(&this->_batches, 1, __ATOMIC_RELAXED);
+	}
+	return (count);
+}
+
+void*	AsyncLogger::_writerRoutine(void* self)
+{
+	AsyncLogger*	logger = static_cast<AsyncLogger*>(self);
+	LogRecord		batch[LOG_BATCH_SIZE];
+	std::string		buffer;
+
+	buffer.reserve(LOG_BATCH_SIZE * 128);
+	while (__atomic_load_n(&logger->_running, __ATOMIC_ACQUIRE))
+	{
+		if (logger->_writeBatch(batch, buffer) == 0)
+			usleep(100);
+	}
+	// drain whatever is left before leaving, stop() picks up the stragglers
+	logger->_drain();
+	return (NULL);
+}
+
+/* Writes batches until the queue is empty; only one thread at a time */
+void	AsyncLogger::_drain(void)
+{
+	LogRecord		batch[LOG_BATCH_SIZE];
+	std::string		buffer;
+
+	while (this->_writeBatch(batch, buffer) != 0)
+		;
+}
+
+
+
+/* Counters */
+
+size_t	AsyncLogger::dropped(void) const
+{
+	return (__atomic_load_n(&this->_dropped, __ATOMIC_RELAXED));
+}
+
+size_t	AsyncLogger::written(void) const
+{
+	return (__atomic_load_n(&this->_written, __ATOMIC_RELAXED));
+}
+
+size_t	AsyncLogger::batches(void) const
+{
+	return (__atomic_load_n(&this->_batches, __ATOMIC_RELAXED));
+}
@@ -0,0 +1,123 @@
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+#include "BinaryLogger.hpp"
+
+BinaryLogger::BinaryLogger(const std::string& path) : _used(0), _records(0)
+{
+	memset(&this->_header, 0, sizeof(this->_header));
+	memcpy(this->_header.magic, BINLOG_MAGIC, 8);
+	this->_fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (this->_fd < 0)
+		return ;
+	this->_header.nsStart = wallClockNs();
+	this->_header.ticksStart = ticks();
+	memcpy(this->_buffer, &this->_header, sizeof(this->_header));
+	this->_used = sizeof(this->_header);
+}
+
+BinaryLogger::~BinaryLogger(void)
+{
+	this->close();
+}
+
+bool	BinaryLogger::isOpen(void) const
+{
+	return (this->_fd >= 0);
+}
+
+size_t	BinaryLogger::records(void) const
+{
+	return (this->_records);
+}
+
+
+
+/* Clocks */
+
+uint64_t	BinaryLogger::ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return (__rdtsc());
+#else
+	return (wallClockNs());
+#endif
+}
+
+uint64_t	BinaryLogger::wallClockNs(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	return ((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+
+
+/* Hot path: one memcpy-sized append, no formatting, no syscall */
+
+void	BinaryLogger::log(int level, const void* args, size_t size)
+{
+	if (this->_fd < 0)
+		return ;
+	if (size > BINLOG_MAX_ARGS)
+		size = BINLOG_MAX_ARGS;
+	if (this->_used + BINLOG_RECORD_HEADER + size > BINLOG_BUFFER_SIZE && !this->_flush())
+		return ;
+
+	char*		out = this->_buffer + this->_used;
+	uint64_t	now = ticks();
+
+	out[0] = static_cast<char>(level);
+	out[1] = static_cast<char>(size);
+	memcpy(out + 2, &now, sizeof(now));
+	if (size > 0)
+		memcpy(out + BINLOG_RECORD_HEADER, args, size);
+	this->_used += BINLOG_RECORD_HEADER + size;
+	this->_records++;
+}
+
+bool	BinaryLogger::_flush(void)
+{
+	size_t	done = 0;
+
+	while (done < this->_used)
+	{
+		ssize_t	n = write(this->_fd, this->_buffer + done, this->_used - done);
+
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (false);
+		done += n;
+	}
+	this->_used = 0;
+	this->_patchHeader();
+	return (true);
+}
+
+/* The end clock pair, now: later than every record written so far */
+void	BinaryLogger::_patchHeader(void)
+{
+	this->_header.ticksEnd = ticks();
+	this->_header.nsEnd = wallClockNs();
+
+	ssize_t	n = pwrite(this->_fd, &this->_header, sizeof(this->_header), 0);
+	(void)n;
+}
+
+/* Flushes pending records, which patches the end clock pair one last time */
+void	BinaryLogger::close(void)
+{
+	if (this->_fd < 0)
+		return ;
+	this->_flush();
+	::close(this->_fd);
+	this->_fd = -1;
+}
@@ -2,7 +2,26 @@
 
 #include "Harl.hpp"
 
-Harl::Harl(void)
+int	Harl::_runtimeLevel = HARL_MIN_LEVEL;
+
+Harl::Harl(void) : _logger(NULL), _binary(NULL)
+{
+	this->_initMemberFunctions();
+}
+
+/* Records are handed to the logger's writer thread instead of std::cout */
+Harl::Harl(AsyncLogger& logger) : _logger(&logger), _binary(NULL)
+{
+	this->_initMemberFunctions();
+}
+
+/* Only the level id and a timestamp are written, harlDecode renders the text */
+Harl::Harl(BinaryLogger& binary) : _logger(NULL), _binary(&binary)
+{
+	this->_initMemberFunctions();
+}
+
+void	Harl::_initMemberFunctions(void)
 {
 	_memberFunctions[0] = &Harl::debug;
 	_memberFunctions[1] = &Harl::error;
@@ -13,40 +32,83 @@ Harl::Harl(void)
 
 Harl::~Harl(void) {}
 
+const char*	Harl::message(int level)
+{
+	static const char*	messages[5] = {
+		"First step into being happy.",
+		"Should be first step tho, gives insight on your work.",
+		"Did you friend told you to write this ? If so, change friends",
+		"This is unacceptable! I want to speak to your manager. Now!",
+		"Would have been funnier if it was an 'otter'. \n"
+			"Anyway, change command this one doesn't exist..."
+	};
+
+	if (level < HARL_DEBUG || level > HARL_OTHER)
+		return (messages[HARL_OTHER]);
+	return (messages[level]);
+}
+
+void	Harl::setRuntimeLevel(int level)
+{
+	_runtimeLevel = level;
+}
+
+int	Harl::runtimeLevel(void)
+{
+	return (_runtimeLevel);
+}
+
+/* The threshold of say<Level>(), for the levels only known at run time */
+bool	Harl::_enabled(int level)
+{
+	if (level < HARL_COMPILED_LEVEL)
+		return (false);
+#ifdef HARL_RUNTIME_LEVEL
+	return (level >= _runtimeLevel);
+#else
+	return (true);
+#endif
+}
+
+void	Harl::_complainAt(int level)
+{
+	if (_enabled(level))
+		this->_emit(level);
+}
+
+void	Harl::_emit(int level)
+{
+	if (this->_binary != NULL)
+		this->_binary->log(level);
+	else if (this->_logger != NULL)
+		this->_logger->log(level, message(level));
+	else
+		std::cout << "[" << AsyncLogger::levelName(level) << "] " << message(level) << std::endl;
+}
+
 void	Harl::debug(void)
 {
-	std::cout
-		<< "[DEBUG] "
-		<< "First step into being happy." << std::endl;
+	this->_complainAt(HARL_DEBUG);
 }
 
 void	Harl::info(void)
 {
-	std::cout
-		<< "[INFO] "
-		<< "Should be first step tho, gives insight on your work." << std::endl;
+	this->_complainAt(HARL_INFO);
 }
 
 void	Harl::warning(void)
 {
-	std::cout
-		<< "[WARNING] "
-		<< "Did you friend told you to write this ? If so, change friends" << std::endl;
+	this->_complainAt(HARL_WARNING);
 }
 
 void	Harl::error(void)
 {
-	std::cout
-		<< "[ERROR] "
-		<< "This is unacceptable! I want to speak to your manager. Now!" << std::endl;
+	this->_complainAt(HARL_ERROR);
 }
 
 void	Harl::other(void)
 {
-	std::cout
-		<< "[OTHER] "
-		<< "Would have been funnier if it was an 'otter'. " << std::endl;
-	std::cout << "Anyway, change command this one doesn't exist..." << std::endl;
+	this->_complainAt(HARL_OTHER);
 }
 
 void	Harl::complain(std::string level)
@@ -56,7 +118,7 @@ void	Harl::complain(std::string level)
         return ;
 	}
 
-	const std::string	_level[4] = {"DEBUG", "ERROR", "INFO", "WARNING"};
+	static const std::string	_level[4] = {"DEBUG", "ERROR", "INFO", "WARNING"};
 
 	for (int i = 0; i < 4; i++) {
 		if (_level[i] == level) {
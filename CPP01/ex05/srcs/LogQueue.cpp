@@ -0,0 +1,72 @@
+#include "LogQueue.hpp"
+
+LogQueue::LogQueue(size_t capacity) : _cells(NULL), _mask(0), _enqueuePos(0), _dequeuePos(0)
+{
+	size_t	size = 2;
+
+	while (size < capacity)
+		size <<= 1;
+	this->_cells = new Cell[size];
+	this->_mask = size - 1;
+	for (size_t i = 0; i < size; i++)
+		this->_cells[i].sequence = i;
+}
+
+LogQueue::~LogQueue(void)
+{
+	delete[] this->_cells;
+}
+
+size_t	LogQueue::capacity(void) const
+{
+	return (this->_mask + 1);
+}
+
+bool	LogQueue::push(const LogRecord& record)
+{
+	size_t	pos = __atomic_load_n(&this->_enqueuePos, __ATOMIC_RELAXED);
+	Cell*	cell;
+
+	for (;;)
+	{
+		cell = &this->_cells[pos & this->_mask];
+
+		size_t		seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+		ptrdiff_t	diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+
+		if (diff == 0)
+		{
+			if (__atomic_compare_exchange_n(&this->_enqueuePos, &pos, pos + 1,
+					true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break ;
+		}
+		else if (diff < 0)
+			return (false);		// full: the consumer has not freed this cell yet
+		else
+			pos = __atomic_load_n(&this->_enqueuePos, __ATOMIC_RELAXED);
+	}
+	cell->record = record;
+	__atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+	return (true);
+}
+
+/* Single consumer: only the writer thread may call this. */
+size_t	LogQueue::popBatch(LogRecord* out, size_t max)
+{
+	size_t	pos = this->_dequeuePos;
+	size_t	count = 0;
+
+	while (count < max)
+	{
+		Cell*	cell = &this->_cells[pos & this->_mask];
+		size_t	seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+
+		if (seq != pos + 1)
+			break ;
+		out[count++] = cell->record;
+		__atomic_store_n(&cell->sequence, pos + this->_mask + 1, __ATOMIC_RELEASE);
+		pos++;
+	}
+	this->_dequeuePos = pos;
+	return (count);
+}
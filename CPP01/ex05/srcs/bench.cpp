@@ -0,0 +1,56 @@
+#include <iostream>
+#include <iomanip>
+
+#include "Harl.hpp"
+
+#define BENCH_ITERATIONS	100000000
+
+/* Keeps the loop alive without adding any work the compiler could not remove */
+#define BARRIER()	__asm__ __volatile__("" ::: "memory")
+
+template <int Level>
+static double	timeSay(Harl& harl, size_t iterations)
+{
+	uint64_t	start = BinaryLogger::wallClockNs();
+
+	for (size_t i = 0; i < iterations; i++)
+	{
+		harl.say<Level>();
+		BARRIER();
+	}
+	return ((double)(BinaryLogger::wallClockNs() - start) / iterations);
+}
+
+static double	timeEmpty(size_t iterations)
+{
+	uint64_t	start = BinaryLogger::wallClockNs();
+
+	for (size_t i = 0; i < iterations; i++)
+		BARRIER();
+	return ((double)(BinaryLogger::wallClockNs() - start) / iterations);
+}
+
+static void	report(const char* name, double ns)
+{
+	std::cout << std::left << std::setw(28) << name
+		<< std::fixed << std::setprecision(3) << ns << " ns/call" << std::endl;
+}
+
+int	main(void)
+{
+	BinaryLogger	sink("/dev/null");
+	Harl			harl(sink);
+
+#ifdef HARL_RUNTIME_LEVEL
+	std::cout << "mode: runtime threshold = " << AsyncLogger::levelName(Harl::runtimeLevel()) << std::endl;
+#else
+	std::cout << "mode: compile-time threshold = " << AsyncLogger::levelName(HARL_MIN_LEVEL) << std::endl;
+#endif
+	report("empty loop", timeEmpty(BENCH_ITERATIONS));
+	report("say<DEBUG>", timeSay<HARL_DEBUG>(harl, BENCH_ITERATIONS));
+	report("say<INFO>", timeSay<HARL_INFO>(harl, BENCH_ITERATIONS));
+	report("say<WARNING>", timeSay<HARL_WARNING>(harl, BENCH_ITERATIONS / 10));
+	report("say<ERROR>", timeSay<HARL_ERROR>(harl, BENCH_ITERATIONS / 10));
+	std::cout << sink.records() << " records written to /dev/null" << std::endl;
+	return (0);
+}
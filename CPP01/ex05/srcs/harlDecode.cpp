@@ -0,0 +1,91 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+
+#include "Harl.hpp"
+
+/* Offline renderer for the files written by Harl(BinaryLogger&) */
+
+/* Whether the header has an end clock pair to map ticks with */
+static bool	calibrated(const BinaryLogHeader& header)
+{
+	return (header.ticksEnd > header.ticksStart && header.nsEnd >= header.nsStart);
+}
+
+static uint64_t	toWallClock(const BinaryLogHeader& header, uint64_t ticks)
+{
+	long double	nsPerTick = (long double)(header.nsEnd - header.nsStart)
+		/ (header.ticksEnd - header.ticksStart);
+
+	return (header.nsStart + (uint64_t)((ticks - header.ticksStart) * nsPerTick));
+}
+
+static bool	decode(const std::vector<char>& data, bool timestamps)
+{
+	BinaryLogHeader	header;
+
+	if (data.size() < sizeof(header))
+		return (false);
+	memcpy(&header, &data[0], sizeof(header));
+	if (memcmp(header.magic, BINLOG_MAGIC, 8) != 0)
+		return (false);
+
+	size_t	pos = sizeof(header);
+
+	while (pos + BINLOG_RECORD_HEADER <= data.size())
+	{
+		int				level = static_cast<unsigned char>(data[pos]);
+		size_t			argSize = static_cast<unsigned char>(data[pos + 1]);
+		uint64_t		ticks;
+
+		memcpy(&ticks, &data[pos + 2], sizeof(ticks));
+		if (pos + BINLOG_RECORD_HEADER + argSize > data.size())
+			return (false);
+		if (timestamps && !calibrated(header))		// no rate known: raw ticks, not ns
+			std::cout << "+" << ticks - header.ticksStart << " ticks ";
+		else if (timestamps)
+		{
+			uint64_t	ns = toWallClock(header, ticks);
+
+			std::cout << ns / 1000000000ull << "." << std::setw(9) << std::setfill('0')
+				<< ns % 1000000000ull << " ";
+		}
+		std::cout << "[" << AsyncLogger::levelName(level) << "] " << Harl::message(level);
+		if (argSize > 0)
+			std::cout << " (" << std::string(&data[pos + BINLOG_RECORD_HEADER], argSize) << ")";
+		std::cout << '\n';
+		pos += BINLOG_RECORD_HEADER + argSize;
+	}
+	return (pos == data.size());
+}
+
+int	main(int ac, char **av)
+{
+	bool	timestamps = ac == 3 && std::string(av[1]) == "-t";
+
+	if (ac != 2 && !timestamps)
+	{
+		std::cout << "Usage: ./harlDecode [-t] <binary log>" << std::endl;
+		return (1);
+	}
+
+	std::ifstream	in(av[ac - 1], std::ios::binary);
+
+	if (!in)
+	{
+		std::cerr << "Error: cannot open '" << av[ac - 1] << "'" << std::endl;
+		return (1);
+	}
+
+	std::vector<char>	data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	if (!decode(data, timestamps))
+	{
+		std::cout << std::flush;
+		std::cerr << "Error: '" << av[ac - 1] << "' is not a valid harl binary log" << std::endl;
+		return (1);
+	}
+	return (0);
+}
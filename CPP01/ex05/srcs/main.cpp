@@ -2,8 +2,69 @@
 
 #include "Harl.hpp"
 
+static void	asyncComplain(int ac, char **av)
+{
+	e_overflowPolicy	policy = OVERFLOW_BLOCK;
+	int					i = 2;
+
+	if (i < ac && std::string(av[i]) == "--drop")
+		policy = OVERFLOW_DROP, i++;
+	else if (i < ac && std::string(av[i]) == "--count")
+		policy = OVERFLOW_COUNT, i++;
+
+	AsyncLogger	logger(4096, policy);
+	Harl		harl(logger);
+
+	for (; i < ac; i++)
+		harl.complain(av[i]);
+	logger.stop();
+	std::cerr << "[async] written: " << logger.written()
+		<< ", dropped: " << logger.dropped()
+		<< ", batches: " << logger.batches() << std::endl;
+}
+
+static int	binaryComplain(int ac, char **av)
+{
+	if (ac < 3)
+	{
+		std::cout << "Usage: ./harl --binary <file> [level...]" << std::endl;
+		return (1);
+	}
+
+	BinaryLogger	binary(av[2]);
+
+	if (!binary.isOpen())
+	{
+		std::cerr << "Error: cannot open '" << av[2] << "'" << std::endl;
+		return (1);
+	}
+
+	Harl		harl(binary);
+	uint64_t	start = BinaryLogger::wallClockNs();
+
+	for (int i = 3; i < ac; i++)
+		harl.complain(av[i]);
+
+	uint64_t	elapsed = BinaryLogger::wallClockNs() - start;
+
+	binary.close();
+	std::cerr << "[binary] " << binary.records() << " records in " << elapsed << " ns";
+	if (binary.records() > 0)
+		std::cerr << " (" << elapsed / binary.records() << " ns/record)";
+	std::cerr << ", decode with ./harlDecode " << av[2] << std::endl;
+	return (0);
+}
+
 int	main(int ac, char **av)
 {
+	if (ac >= 2 && std::string(av[1]) == "--async")
+	{
+		asyncComplain(ac, av);
+		return (0);
+	}
+	if (ac >= 2 && std::string(av[1]) == "--binary")
+		return (binaryComplain(ac, av));
+
 	Harl	harl;
 
 	if (ac < 2)
@@ -25,6 +25,9 @@ class Harl {
 		~Harl(void);
 
 		void	complain(std::string level);
+
+		static e_levelEnum	toLevel(const std::string& level);
+		static unsigned int	levelsFrom(e_levelEnum level);
 };
 
 
@@ -0,0 +1,55 @@
+#ifndef LOGFILTER_HPP
+# define LOGFILTER_HPP
+
+# include <string>
+# include <vector>
+
+# include "Harl.hpp"
+
+# define FILTER_CHUNK_SIZE	(4 * 1024 * 1024)
+# define FILTER_MAX_THREADS	64
+
+/*
+ * Keeps the lines of a log whose "[LEVEL]" tag is in the accepted set.
+ * Untagged lines (e.g. the second line of an OTHER complaint) follow the
+ * decision taken for the last tagged line above them.
+ *
+ * Input is read in rounds of `threads` chunks of FILTER_CHUNK_SIZE bytes,
+ * cut on newlines, filtered in parallel and written back in file order.
+ */
+class	LogFilter
+{
+	private:
+		struct	Piece
+		{
+			const char*		begin;
+			const char*		end;
+			const char*		leadingEnd;		// untagged lines before the first tag
+			bool			hasTag;
+			bool			lastAccepted;
+			unsigned int	accepted;
+			std::string		out;
+		};
+
+		unsigned int	_accepted;
+		int				_threads;
+		bool			_carryAccepted;	// decision of the last tagged line written so far
+
+		static void*	_filterRoutine(void* piece);
+		static void		_filterPiece(Piece& piece);
+		static void		_endLine(Piece& piece, const char* start, const char* end, int level);
+		static int		_matchTag(const char* tag, const char* end);
+
+		bool			_filterRound(const char* data, size_t size, int outFd);
+
+		LogFilter(const LogFilter& copy);
+		LogFilter&	operator=(const LogFilter& src);
+
+	public:
+		LogFilter(e_levelEnum minLevel, int threads = 1);
+		~LogFilter(void);
+
+		bool	run(int inFd, int outFd);
+};
+
+#endif
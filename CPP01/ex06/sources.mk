@@ -5,4 +5,5 @@ SRC	+= $(addsuffix .cpp, $(MAIN))
 
 override MAIN			:= \
 	Harl \
+	LogFilter \
 	main \
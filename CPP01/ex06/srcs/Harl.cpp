@@ -43,7 +43,7 @@ void	Harl::other(void)
 	std::cout << "Anyway, change command this one doesn't exist..." << std::endl;
 }
 
-void	Harl::complain(std::string level)
+e_levelEnum	Harl::toLevel(const std::string& level)
 {
 	const std::string levels[4] = {"DEBUG", "ERROR", "INFO", "WARNING"};
 
@@ -52,8 +52,34 @@ void	Harl::complain(std::string level)
 	for (; start < OTHER; start++)
 		if (levels[start] == level)
 			break ;
+	return (static_cast<e_levelEnum>(start));
+}
 
-	switch (start)
+/* Same fallthrough as complain(): a level lets itself and everything above through */
+unsigned int	Harl::levelsFrom(e_levelEnum level)
+{
+	unsigned int	mask = 0;
+
+	switch (level)
+	{
+		case DEBUG:
+			mask |= 1u << DEBUG; //fallthrough
+		case INFO:
+			mask |= 1u << INFO; //fallthrough
+		case WARNING:
+			mask |= 1u << WARNING; //fallthrough
+		case ERROR:
+			mask |= 1u << ERROR;
+			break ;
+		default:
+			break ;
+	}
+	return (mask);
+}
+
+void	Harl::complain(std::string level)
+{
+	switch (toLevel(level))
 	{
 		case DEBUG:
 			this->debug(); //fallthrough
@@ -0,0 +1,261 @@
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef __SSE2__
+# include <immintrin.h>
+#endif
+
+#include "LogFilter.hpp"
+
+LogFilter::LogFilter(e_levelEnum minLevel, int threads)
+	: _accepted(Harl::levelsFrom(minLevel)), _threads(threads), _carryAccepted(false)
+{
+	if (this->_threads < 1)
+		this->_threads = 1;
+	if (this->_threads > FILTER_MAX_THREADS)
+		this->_threads = FILTER_MAX_THREADS;
+}
+
+LogFilter::~LogFilter(void) {}
+
+
+
+/* Tag recognition */
+
+int	LogFilter::_matchTag(const char* tag, const char* end)
+{
+	size_t	left = end - tag;
+
+	switch (left > 0 ? *tag : 0)
+	{
+		case 'D':
+			return (left >= 6 && !memcmp(tag, "DEBUG]", 6) ? DEBUG : -1);
+		case 'I':
+			return (left >= 5 && !memcmp(tag, "INFO]", 5) ? INFO : -1);
+		case 'W':
+			return (left >= 8 && !memcmp(tag, "WARNING]", 8) ? WARNING : -1);
+		case 'E':
+			return (left >= 6 && !memcmp(tag, "ERROR]", 6) ? ERROR : -1);
+		default:
+			return (-1);
+	}
+}
+
+void	LogFilter::_endLine(Piece& piece, const char* start, const char* end, int level)
+{
+	if (level >= 0)
+	{
+		piece.hasTag = true;
+		piece.lastAccepted = (piece.accepted & (1u << level)) != 0;
+		if (piece.lastAccepted)
+			piece.out.append(start, end);
+	}
+	else if (!piece.hasTag)
+		piece.leadingEnd = end;
+	else if (piece.lastAccepted)
+		piece.out.append(start, end);
+}
+
+/*
+ * Looks for '\n' and '[' in 32 (AVX2) or 16 (SSE2) bytes at once: a single
+ * movemask gives every candidate position of the block, so the bytes in
+ * between are never looked at one by one.
+ */
+void	LogFilter::_filterPiece(Piece& piece)
+{
+	const char*	p = piece.begin;
+	const char*	end = piece.end;
+	const char*	lineStart = p;
+	int			level = -1;
+
+	piece.leadingEnd = p;
+	piece.out.reserve(end - p);
+
+#ifdef __AVX2__
+	const __m256i	newline32 = _mm256_set1_epi8('\n');
+	const __m256i	bracket32 = _mm256_set1_epi8('[');
+
+	for (; p + 32 <= end; p += 32)
+	{
+		__m256i			block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+		unsigned int	bits = _mm256_movemask_epi8(_mm256_or_si256(
+			_mm256_cmpeq_epi8(block, newline32), _mm256_cmpeq_epi8(block, bracket32)));
+
+		while (bits)
+		{
+			const char*	hit = p + __builtin_ctz(bits);
+
+			bits &= bits - 1;
+			if (*hit == '\n')
+			{
+				_endLine(piece, lineStart, hit + 1, level);
+				lineStart = hit + 1;
+				level = -1;
+			}
+			else if (level < 0)
+				level = _matchTag(hit + 1, end);
+		}
+	}
+#endif
+#ifdef __SSE2__
+	const __m128i	newline = _mm_set1_epi8('\n');
+	const __m128i	bracket = _mm_set1_epi8('[');
+
+	for (; p + 16 <= end; p += 16)
+	{
+		__m128i			block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		unsigned int	bits = _mm_movemask_epi8(_mm_or_si128(
+			_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, bracket)));
+
+		while (bits)
+		{
+			const char*	hit = p + __builtin_ctz(bits);
+
+			bits &= bits - 1;
+			if (*hit == '\n')
+			{
+				_endLine(piece, lineStart, hit + 1, level);
+				lineStart = hit + 1;
+				level = -1;
+			}
+			else if (level < 0)
+				level = _matchTag(hit + 1, end);
+		}
+	}
+#endif
+	for (; p < end; p++)
+	{
+		if (*p == '\n')
+		{
+			_endLine(piece, lineStart, p + 1, level);
+			lineStart = p + 1;
+			level = -1;
+		}
+		else if (*p == '[' && level < 0)
+			level = _matchTag(p + 1, end);
+	}
+	if (lineStart < end)
+		_endLine(piece, lineStart, end, level);
+}
+
+void*	LogFilter::_filterRoutine(void* piece)
+{
+	_filterPiece(*static_cast<Piece*>(piece));
+	return (NULL);
+}
+
+
+
+/* Driver */
+
+static bool	writeAll(int fd, const char* data, size_t size)
+{
+	while (size > 0)
+	{
+		ssize_t	n = write(fd, data, size);
+
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (false);
+		data += n;
+		size -= n;
+	}
+	return (true);
+}
+
+bool	LogFilter::_filterRound(const char* data, size_t size, int outFd)
+{
+	std::vector<Piece>		pieces(this->_threads);
+	std::vector<pthread_t>	workers(this->_threads);
+	std::vector<bool>		started(this->_threads, false);
+	const char*				end = data + size;
+	const char*				cursor = data;
+	size_t					count = 0;
+
+	// newline aligned slices of roughly size / threads bytes
+	for (int i = 0; i < this->_threads && cursor < end; i++)
+	{
+		const char*	cut = end;
+
+		if (i + 1 < this->_threads && (size_t)(end - cursor) > size / this->_threads)
+		{
+			const char*	nl = static_cast<const char*>(
+				memchr(cursor + size / this->_threads, '\n', end - cursor - size / this->_threads));
+			if (nl != NULL)
+				cut = nl + 1;
+		}
+		pieces[i].begin = cursor;
+		pieces[i].end = cut;
+		pieces[i].hasTag = false;
+		pieces[i].lastAccepted = false;
+		pieces[i].accepted = this->_accepted;
+		cursor = cut;
+		count++;
+	}
+	for (size_t i = 1; i < count; i++)
+		started[i] = pthread_create(&workers[i], NULL, &LogFilter::_filterRoutine, &pieces[i]) == 0;
+	for (size_t i = 0; i < count; i++)
+		if (!started[i])
+			_filterPiece(pieces[i]);
+	for (size_t i = 1; i < count; i++)
+		if (started[i])
+			pthread_join(workers[i], NULL);
+
+	// merge in file order: leading untagged lines depend on the previous piece
+	for (size_t i = 0; i < count; i++)
+	{
+		Piece&	piece = pieces[i];
+
+		if (this->_carryAccepted
+			&& !writeAll(outFd, piece.begin, piece.leadingEnd - piece.begin))
+			return (false);
+		if (!writeAll(outFd, piece.out.data(), piece.out.size()))
+			return (false);
+		if (piece.hasTag)
+			this->_carryAccepted = piece.lastAccepted;
+	}
+	return (true);
+}
+
+bool	LogFilter::run(int inFd, int outFd)
+{
+	std::vector<char>	buffer((size_t)this->_threads * FILTER_CHUNK_SIZE);
+	size_t				filled = 0;
+	bool				eof = false;
+
+	while (!eof || filled > 0)
+	{
+		while (!eof && filled < buffer.size())
+		{
+			ssize_t	n = read(inFd, &buffer[filled], buffer.size() - filled);
+
+			if (n < 0 && errno == EINTR)
+				continue ;
+			if (n < 0)
+				return (false);
+			if (n == 0)
+				eof = true;
+			filled += n;
+		}
+
+		size_t	cut = filled;
+
+		if (!eof)
+		{
+			while (cut > 0 && buffer[cut - 1] != '\n')
+				cut--;
+			if (cut == 0)
+			{
+				buffer.resize(buffer.size() * 2);	// a single line larger than the buffer
+				continue ;
+			}
+		}
+		if (!this->_filterRound(&buffer[0], cut, outFd))
+			return (false);
+		memmove(&buffer[0], &buffer[cut], filled - cut);
+		filled -= cut;
+	}
+	return (true);
+}
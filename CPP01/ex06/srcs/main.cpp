@@ -1,6 +1,45 @@
 #include <iostream>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "Harl.hpp"
+#include "LogFilter.hpp"
+
+static int	filterFile(const std::string& level, const char* path, const char* threads)
+{
+	e_levelEnum	minLevel = Harl::toLevel(level);
+
+	if (minLevel == OTHER)
+	{
+		std::cerr << "Error: unknown level '" << level << "'" << std::endl;
+		return (1);
+	}
+
+	int	jobs = 1;
+
+	if (threads != NULL)
+		jobs = std::atoi(threads);
+	if (jobs <= 0)
+		jobs = sysconf(_SC_NPROCESSORS_ONLN);
+
+	int	fd = std::string(path) == "-" ? STDIN_FILENO : open(path, O_RDONLY);
+
+	if (fd < 0)
+	{
+		std::cerr << "Error: cannot open '" << path << "'" << std::endl;
+		return (1);
+	}
+
+	LogFilter	filter(minLevel, jobs);
+	bool		ok = filter.run(fd, STDOUT_FILENO);
+
+	if (fd != STDIN_FILENO)
+		close(fd);
+	if (!ok)
+		std::cerr << "Error: I/O failure while filtering '" << path << "'" << std::endl;
+	return (ok ? 0 : 1);
+}
 
 int	main(int ac, char **av)
 {
@@ -8,7 +47,12 @@ int	main(int ac, char **av)
 
 	if (ac == 2)
 		harl.complain(av[1]);
+	else if (ac == 3 || ac == 4)
+		return (filterFile(av[1], av[2], ac == 4 ? av[3] : NULL));
 	else
+	{
 		std::cout << "Usage: ./harlFilter <arg>" << std::endl;
+		std::cout << "       ./harlFilter <level> <logfile|-> [threads, 0 = all cores]" << std::endl;
+	}
 	return (0);
 }
@@ -0,0 +1,44 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include <cstddef>
+# include <stdint.h>
+
+/*
+ * Tiny harness shared by the fixedBench sections (make bench). Every
+ * report() line is also recorded, for writeJson().
+ */
+class	Bench
+{
+	public:
+		static uint64_t	nowNs(void);
+		static double	cyclesPerNs(void);
+		static void		section(const char* name);
+		static void		report(const char* name, uint64_t ns, size_t ops);
+		static bool		writeJson(const char* path);
+
+		/* Makes `value` look used so the measured work is not optimised away */
+		template <typename T>
+		static void		keep(const T& value)
+		{
+			__asm__ __volatile__("" : : "m"(value) : "memory");
+		}
+
+		/* Makes everything in memory look modified between two repetitions */
+		static void		clobber(void)
+		{
+			__asm__ __volatile__("" : : : "memory");
+		}
+};
+
+void	benchKernels(void);
+void	benchDivision(void);
+void	benchConvert(void);
+void	benchMath(void);
+void	benchDecimal(void);
+void	benchQuery(void);
+void	benchIndex(void);
+void	benchParallel(void);
+void	benchOperators(void);
+
+#endif
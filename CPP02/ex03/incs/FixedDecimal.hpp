@@ -0,0 +1,37 @@
+#ifndef FIXEDDECIMAL_HPP
+# define FIXEDDECIMAL_HPP
+
+# include <cstddef>
+
+# include "Fixed.hpp"
+
+/*
+ * Decimal text <-> Fixed raw bits, without going through float and without
+ * allocating.
+ *
+ * Every 24.8 value is k / 256, which has a finite decimal expansion of at
+ * most 8 fractional digits: format() writes that expansion exactly, with
+ * trailing zeros dropped ("-3.5", "0.00390625", "42"). parse() reads
+ * [+-]digits[.digits] and rounds to the nearest raw value, ties away from
+ * zero like Fixed(float), so parse(format(x)) == x for every x.
+ */
+class	FixedDecimal
+{
+	private:
+		FixedDecimal(void);
+		FixedDecimal(const FixedDecimal& copy);
+		~FixedDecimal(void);
+
+		FixedDecimal&	operator=(const FixedDecimal& src);
+
+	public:
+		enum { BUFFER_SIZE = 18 };	// "-8388608.99609375" and its '\0'
+
+		// returns the length written (without the '\0'), 0 if size is too small
+		static size_t	format(const Fixed& value, char* buffer, size_t size);
+		// returns the number of characters read, 0 (and out untouched) on a
+		// malformed or out of range number
+		static size_t	parse(const char* str, Fixed& out);
+};
+
+#endif
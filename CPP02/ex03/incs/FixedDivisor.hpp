@@ -0,0 +1,62 @@
+#ifndef FIXEDDIVISOR_HPP
+# define FIXEDDIVISOR_HPP
+
+# include "Fixed.hpp"
+# include "FixedSpan.hpp"
+
+/*
+ * Division by a divisor known in advance, without any divide instruction
+ * on the hot path.
+ *
+ * The constructor computes m = floor((2^64 - 1) / |d|): a double estimate
+ * (53 bits) refined by one Newton-Raphson step in 128-bit integers, then
+ * nudged to the exact floor. A quotient is then q = (|x| * 256 * m) >> 64,
+ * which is never too big and at most 1 ulp (1/256) too small; one
+ * branch-free remainder check fixes that ulp.
+ *
+ * Error bound: none. Results are bit-identical to Fixed::operator/ (the
+ * 64-bit quotient truncated toward zero) whenever that one does not
+ * overflow, and wrap to 32 bits like raw int arithmetic when it would.
+ * Dividing by zero gives 0, like Fixed, but silently.
+ */
+class	FixedDivisor
+{
+	private:
+		unsigned long long	_reciprocal;
+		unsigned int		_magnitude;
+		int					_negative;
+
+	public:
+		FixedDivisor(void);
+		FixedDivisor(const Fixed& divisor);
+		FixedDivisor(const FixedDivisor& copy);
+
+		~FixedDivisor(void);
+
+		FixedDivisor&	operator=(const FixedDivisor& src);
+
+		int		divideRaw(int raw) const;
+		Fixed	divide(const Fixed& dividend) const;
+		void	divide(FixedSpan span) const;
+};
+
+/* Hot path, inline so that loops over it keep the reciprocal in registers */
+inline int	FixedDivisor::divideRaw(int raw) const
+{
+	if (this->_magnitude == 0)
+		return (0);
+
+	const int					negative = (raw < 0) ^ this->_negative;
+	const unsigned long long	n = (unsigned long long)(raw < 0 ? -(long long)raw : (long long)raw) << 8;
+	unsigned long long			q = (unsigned long long)(((unsigned __int128)n * this->_reciprocal) >> 64);
+
+	// q is exact or one too small
+	q += (n - q * this->_magnitude) >= this->_magnitude;
+
+	// branch-free sign: random signs would mispredict a conditional negate
+	const unsigned int	mask = 0u - (unsigned int)negative;
+
+	return ((int)(((unsigned int)q ^ mask) - mask));
+}
+
+#endif
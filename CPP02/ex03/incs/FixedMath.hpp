@@ -0,0 +1,41 @@
+#ifndef FIXEDMATH_HPP
+# define FIXEDMATH_HPP
+
+# include "Fixed.hpp"
+
+/*
+ * Integer-only elementary functions on Fixed (24.8). No float or double is
+ * involved at any point, so results are the same on every platform.
+ * Accuracy is in ulps of the result (1 ulp = 1/256) against libm in double,
+ * over every raw input in [-400000, 400000] plus a stride-997 sweep of the
+ * whole int range:
+ *
+ *  sqrt(x)         0.5 ulp (correctly rounded), 0 for x <= 0
+ *  reciprocal(x)   0.5 ulp (correctly rounded), 0 for x == 0
+ *  sin(x), cos(x)  0.5 ulp for any x (CORDIC, 30 steps in 2.30 after a
+ *                  reduction modulo 2pi carried to 64 fractional bits)
+ *  atan2(y, x)     0.5 ulp, in [-pi, pi], atan2(0, 0) == 0 (CORDIC)
+ *  exp(x)          0.5 ulp, saturates to the largest Fixed above ~15.94
+ *  log(x)          0.5 ulp, the smallest Fixed (-8388608) for x <= 0
+ */
+class	FixedMath
+{
+	private:
+		FixedMath(void);
+		FixedMath(const FixedMath& copy);
+		~FixedMath(void);
+
+		FixedMath&	operator=(const FixedMath& src);
+
+	public:
+		static Fixed	sqrt(const Fixed& x);
+		static Fixed	reciprocal(const Fixed& x);
+		static Fixed	sin(const Fixed& x);
+		static Fixed	cos(const Fixed& x);
+		static void		sincos(const Fixed& x, Fixed& sinOut, Fixed& cosOut);
+		static Fixed	atan2(const Fixed& y, const Fixed& x);
+		static Fixed	exp(const Fixed& x);
+		static Fixed	log(const Fixed& x);
+};
+
+#endif
@@ -0,0 +1,332 @@
+#ifndef FIXEDPOINT_HPP
+# define FIXEDPOINT_HPP
+
+# include <iostream>
+
+/*
+ * Fixed generalised over the number of fractional bits and the width of the
+ * raw value. Everything is defined inline here so that, with -O2, constant
+ * expressions built from FixedPoint fold down to a single immediate (C++98
+ * has no constexpr, FixedLiteral below covers the cases that must be true
+ * compile-time constants). The __builtin_round* calls are what lets GCC and
+ * clang fold the float constructors, the C99 roundf is opaque in C++98.
+ */
+
+template <typename Storage>
+struct	FixedTraits;
+
+template <>
+struct	FixedTraits<short>
+{
+	typedef int					Wide;
+	typedef unsigned short		Unsigned;
+	enum { bits = 16 };
+};
+
+template <>
+struct	FixedTraits<int>
+{
+	typedef long long			Wide;
+	typedef unsigned int		Unsigned;
+	enum { bits = 32 };
+};
+
+template <>
+struct	FixedTraits<long long>
+{
+	typedef __int128			Wide;
+	typedef unsigned long long	Unsigned;
+	enum { bits = 64 };
+};
+
+/* The wider of two wide types, to convert between formats without losing bits */
+template <typename A, typename B, bool FirstWider = (sizeof(A) >= sizeof(B))>
+struct	FixedWider
+{
+	typedef A	type;
+};
+
+template <typename A, typename B>
+struct	FixedWider<A, B, false>
+{
+	typedef B	type;
+};
+
+/*
+ * Overflow policies: what +, -, * and / do when the result does not fit.
+ * All of them are branch free (masks and cmov-friendly selects), never
+ * print anything, and plain loops over them auto-vectorise at -O2/-O3.
+ *
+ *  - FixedWrap:     two's complement wrap-around, the cheapest
+ *  - FixedSaturate: clamps to the largest/smallest representable value
+ *  - FixedChecked:  wraps, and sets a sticky per-thread flag to test later
+ */
+struct	FixedWrap
+{
+	template <typename S>
+	static S	add(S a, S b)
+	{
+		typedef typename FixedTraits<S>::Unsigned	U;
+
+		return ((S)(U)((U)a + (U)b));
+	}
+
+	template <typename S>
+	static S	sub(S a, S b)
+	{
+		typedef typename FixedTraits<S>::Unsigned	U;
+
+		return ((S)(U)((U)a - (U)b));
+	}
+
+	template <typename S, typename W>
+	static S	narrow(W wide)
+	{
+		return ((S)wide);
+	}
+
+	template <typename S>
+	static S	divideByZero(S)
+	{
+		return (0);
+	}
+};
+
+struct	FixedSaturate
+{
+	template <typename S>
+	static S	limit(S negativeMask)
+	{
+		typedef typename FixedTraits<S>::Unsigned	U;
+		const S	max = (S)((U)-1 >> 1);
+
+		return ((S)(max ^ negativeMask));	// max for positives, min for negatives
+	}
+
+	template <typename S>
+	static S	add(S a, S b)
+	{
+		const S	r = FixedWrap::add(a, b);
+		const S	overflow = (S)((S)((a ^ r) & (b ^ r)) >> (FixedTraits<S>::bits - 1));
+
+		return ((S)((r & ~overflow) | (limit<S>((S)(a >> (FixedTraits<S>::bits - 1))) & overflow)));
+	}
+
+	template <typename S>
+	static S	sub(S a, S b)
+	{
+		const S	r = FixedWrap::sub(a, b);
+		const S	overflow = (S)((S)((a ^ b) & (a ^ r)) >> (FixedTraits<S>::bits - 1));
+
+		return ((S)((r & ~overflow) | (limit<S>((S)(a >> (FixedTraits<S>::bits - 1))) & overflow)));
+	}
+
+	template <typename S, typename W>
+	static S	narrow(W wide)
+	{
+		const W	lo = (W)limit<S>((S)-1);
+		const W	hi = (W)limit<S>(0);
+
+		wide = wide < lo ? lo : wide;
+		return ((S)(wide > hi ? hi : wide));
+	}
+
+	template <typename S>
+	static S	divideByZero(S numerator)
+	{
+		return (numerator == 0 ? 0 : limit<S>((S)(numerator >> (FixedTraits<S>::bits - 1))));
+	}
+};
+
+struct	FixedChecked
+{
+	static int&	flag(void)
+	{
+		static __thread int	sticky = 0;
+
+		return (sticky);
+	}
+
+	static bool	overflowed(void) { return (flag() != 0); }
+	static void	clear(void) { flag() = 0; }
+
+	template <typename S>
+	static S	add(S a, S b)
+	{
+		S	r;
+
+		flag() |= __builtin_add_overflow(a, b, &r);
+		return (r);
+	}
+
+	template <typename S>
+	static S	sub(S a, S b)
+	{
+		S	r;
+
+		flag() |= __builtin_sub_overflow(a, b, &r);
+		return (r);
+	}
+
+	template <typename S, typename W>
+	static S	narrow(W wide)
+	{
+		const S	r = (S)wide;
+
+		flag() |= (W)r != wide;
+		return (r);
+	}
+
+	template <typename S>
+	static S	divideByZero(S)
+	{
+		flag() = 1;
+		return (0);
+	}
+};
+
+template <int FracBits, typename Storage = int, typename Policy = FixedWrap>
+class	FixedPoint
+{
+	public:
+		typedef Storage								storage_type;
+		typedef typename FixedTraits<Storage>::Wide	wide_type;
+		typedef Policy								policy_type;
+
+		enum
+		{
+			fractionalBits = FracBits,
+			storageBits = FixedTraits<Storage>::bits,
+			integerBits = storageBits - FracBits
+		};
+
+		static const Storage	one = (Storage)1 << FracBits;
+
+	private:
+		Storage		_raw;
+
+	public:
+		FixedPoint(void) : _raw(0) {}
+		FixedPoint(const FixedPoint& copy) : _raw(copy._raw) {}
+		FixedPoint(const int number) : _raw((Storage)number * one) {}
+		FixedPoint(const float number) : _raw((Storage)__builtin_roundf(number * one)) {}
+		FixedPoint(const double number) : _raw((Storage)__builtin_round(number * one)) {}
+
+		/*
+		 * Precision/range conversion, e.g. Fixed16_16(Fixed24_8(x)): truncates
+		 * extra fractional bits. Rescaled in the wider of both wide types, then
+		 * narrowed by Policy: Saturate clamps and Checked flags what does not fit.
+		 */
+		template <int OtherBits, typename OtherStorage, typename OtherPolicy>
+		explicit FixedPoint(const FixedPoint<OtherBits, OtherStorage, OtherPolicy>& other)
+		{
+			typedef typename FixedWider<wide_type,
+				typename FixedTraits<OtherStorage>::Wide>::type	Both;
+
+			const Both	raw = other.getRawBits();
+
+			if (OtherBits > FracBits)
+				this->_raw = Policy::template narrow<Storage>((Both)(raw >> (OtherBits > FracBits ? OtherBits - FracBits : 0)));
+			else
+				this->_raw = Policy::template narrow<Storage>((Both)(raw * ((Both)1 << (FracBits > OtherBits ? FracBits - OtherBits : 0))));
+		}
+
+		~FixedPoint(void) {}
+
+		FixedPoint&	operator=(const FixedPoint& src)
+		{
+			this->_raw = src._raw;
+			return (*this);
+		}
+
+		static FixedPoint	fromRaw(const Storage raw)
+		{
+			FixedPoint	ret;
+
+			ret._raw = raw;
+			return (ret);
+		}
+
+		Storage	getRawBits(void) const { return (this->_raw); }
+		void	setRawBits(Storage const raw) { this->_raw = raw; }
+
+		float	toFloat(void) const { return ((float)this->_raw / one); }
+		double	toDouble(void) const { return ((double)this->_raw / one); }
+		int		toInt(void) const { return ((int)(this->_raw >> FracBits)); }
+
+		bool	operator>(const FixedPoint& rhs) const { return (this->_raw > rhs._raw); }
+		bool	operator<(const FixedPoint& rhs) const { return (this->_raw < rhs._raw); }
+		bool	operator>=(const FixedPoint& rhs) const { return (this->_raw >= rhs._raw); }
+		bool	operator<=(const FixedPoint& rhs) const { return (this->_raw <= rhs._raw); }
+		bool	operator==(const FixedPoint& rhs) const { return (this->_raw == rhs._raw); }
+		bool	operator!=(const FixedPoint& rhs) const { return (this->_raw != rhs._raw); }
+
+		FixedPoint	operator+(const FixedPoint& rhs) const
+		{
+			return (fromRaw(Policy::add(this->_raw, rhs._raw)));
+		}
+
+		FixedPoint	operator-(const FixedPoint& rhs) const
+		{
+			return (fromRaw(Policy::sub(this->_raw, rhs._raw)));
+		}
+
+		FixedPoint	operator*(const FixedPoint& rhs) const
+		{
+			return (fromRaw(Policy::template narrow<Storage>(((wide_type)this->_raw * rhs._raw) >> FracBits)));
+		}
+
+		FixedPoint	operator/(const FixedPoint& rhs) const
+		{
+			if (rhs._raw == 0)
+				return (fromRaw(Policy::divideByZero(this->_raw)));
+			return (fromRaw(Policy::template narrow<Storage>(((wide_type)this->_raw * one) / rhs._raw)));
+		}
+
+		FixedPoint&	operator++(void) { this->_raw++; return (*this); }
+		FixedPoint&	operator--(void) { this->_raw--; return (*this); }
+		FixedPoint	operator++(int) { FixedPoint res = *this; this->_raw++; return (res); }
+		FixedPoint	operator--(int) { FixedPoint res = *this; this->_raw--; return (res); }
+
+		static FixedPoint&	min(FixedPoint& a, FixedPoint& b) { return (a._raw < b._raw ? a : b); }
+		static FixedPoint&	max(FixedPoint& a, FixedPoint& b) { return (a._raw > b._raw ? a : b); }
+		static const FixedPoint&	min(const FixedPoint& a, const FixedPoint& b) { return (a._raw < b._raw ? a : b); }
+		static const FixedPoint&	max(const FixedPoint& a, const FixedPoint& b) { return (a._raw > b._raw ? a : b); }
+};
+
+template <int FracBits, typename Storage, typename Policy>
+const Storage	FixedPoint<FracBits, Storage, Policy>::one;
+
+template <int FracBits, typename Storage, typename Policy>
+std::ostream&	operator<<(std::ostream& outStream, const FixedPoint<FracBits, Storage, Policy>& value)
+{
+	outStream << value.toDouble();
+	return (outStream);
+}
+
+/*
+ * Raw bits of Numerator / Denominator as an integral constant expression,
+ * rounded to nearest (half away from zero), usable in enums, array sizes
+ * and template arguments: FixedLiteral<8, int, 314159, 100000>::raw == 804
+ */
+template <int FracBits, typename Storage, long long Numerator, long long Denominator>
+struct	FixedLiteral
+{
+	static const Storage	raw = (Storage)((Numerator * ((long long)1 << FracBits) * 2
+		+ (Numerator < 0 ? -Denominator : Denominator)) / (2 * Denominator));
+
+	static FixedPoint<FracBits, Storage>	value(void)
+	{
+		return (FixedPoint<FracBits, Storage>::fromRaw(raw));
+	}
+};
+
+typedef FixedPoint<8, short>		Fixed8_8;
+typedef FixedPoint<8, int>			Fixed24_8;		// same layout as Fixed
+typedef FixedPoint<16, int>			Fixed16_16;
+typedef FixedPoint<32, long long>	Fixed32_32;
+
+typedef FixedPoint<8, int, FixedSaturate>	SatFixed24_8;
+typedef FixedPoint<8, int, FixedChecked>	CheckedFixed24_8;
+
+#endif
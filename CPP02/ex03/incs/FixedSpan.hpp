@@ -0,0 +1,88 @@
+#ifndef FIXEDSPAN_HPP
+# define FIXEDSPAN_HPP
+
+# include <cstddef>
+
+# include "Fixed.hpp"
+
+/*
+ * Non owning view over contiguous Fixed raw bits (24.8, int). The bulk
+ * operations work in place on the view, over min(size(), rhs.size())
+ * elements, with AVX2 or SSE4.1 when the build enables them
+ * (-mavx2 / -msse4.1 / -march=native) and a scalar loop otherwise.
+ *
+ * Results are bit-identical across the three paths:
+ *  - add/sub wrap like raw int arithmetic
+ *  - mul/scale keep the low 32 bits of ((int64)a * b) >> 8
+ *  - dot sums the full 64-bit products and shifts once at the end
+ *  - fromFloat/toFloat give exactly Fixed(float) / Fixed::toFloat() for
+ *    |value| < 2^23 (beyond that the scalar conversion is undefined anyway)
+ */
+class	FixedSpan
+{
+	private:
+		int*	_data;
+		size_t	_size;
+
+	public:
+		FixedSpan(void);
+		FixedSpan(int* data, size_t size);
+		FixedSpan(const FixedSpan& copy);
+
+		~FixedSpan(void);
+
+		FixedSpan&	operator=(const FixedSpan& src);
+
+		int*		data(void) const;
+		size_t		size(void) const;
+		FixedSpan	subspan(size_t offset, size_t count) const;
+
+		Fixed		get(size_t index) const;
+		void		set(size_t index, const Fixed& value);
+
+		void		add(const FixedSpan& rhs);
+		void		sub(const FixedSpan& rhs);
+		void		mul(const FixedSpan& rhs);
+		void		scale(const Fixed& factor);
+		Fixed		dot(const FixedSpan& rhs) const;
+		long long	dotRaw(const FixedSpan& rhs) const;
+
+		void		fromFloat(const float* src);
+		void		toFloat(float* dst) const;
+};
+
+/* Owning, 32-byte aligned storage for FixedSpan */
+class	FixedVector
+{
+	private:
+		int*	_data;
+		size_t	_size;
+		size_t	_capacity;
+
+		void	_grow(size_t capacity);
+
+	public:
+		FixedVector(void);
+		FixedVector(size_t size, const Fixed& value = Fixed());
+		FixedVector(const FixedVector& copy);
+
+		~FixedVector(void);
+
+		FixedVector&	operator=(const FixedVector& src);
+
+		size_t		size(void) const;
+		size_t		capacity(void) const;
+		int*		data(void);
+		const int*	data(void) const;
+		FixedSpan	span(void);
+
+		void		resize(size_t size, const Fixed& value = Fixed());
+		void		reserve(size_t capacity);
+		void		push_back(const Fixed& value);
+		void		clear(void);
+
+		Fixed		get(size_t index) const;
+		void		set(size_t index, const Fixed& value);
+};
+
+#endif
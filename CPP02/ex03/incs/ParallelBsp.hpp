@@ -0,0 +1,92 @@
+#ifndef PARALLELBSP_HPP
+# define PARALLELBSP_HPP
+
+# include <cstddef>
+# include <vector>
+# include <pthread.h>
+
+# include "TriangleQuery.hpp"
+# include "TriangleGrid.hpp"
+# include "PointCloud.hpp"
+
+/*
+ * Point classification over huge point sets on a pool of pthreads.
+ *
+ * The points are cut into tasks of TASK_POINTS. Every worker starts with
+ * a contiguous range of tasks, kept as one 64-bit word (begin | end << 32)
+ * so that it can be changed with a single CAS: the owner takes tasks from
+ * the front, a worker that runs dry steals the back half of someone
+ * else's range. The caller's thread is worker 0, so ParallelBsp(1) runs
+ * everything inline without any thread.
+ *
+ * Results do not depend on the thread count or on who stole what:
+ *  - classify() and locate() write each point's answer in place
+ *  - collect() gathers the indices of the points inside in per-worker
+ *    buffers, tagged by task, and merges them in task order (ascending)
+ */
+class	ParallelBsp
+{
+	public:
+		enum { TASK_POINTS = 16384 };
+
+	private:
+		struct	Worker
+		{
+			unsigned long long			range;
+			pthread_t					thread;
+			ParallelBsp*				pool;
+			unsigned int				index;
+			size_t						found;
+			size_t						steals;
+			std::vector<size_t>			indices;	// collect(): inside points
+			std::vector<size_t>			spans;		// collect(): task, offset, length
+			char						pad[64];	// no false sharing on range
+		};
+
+		enum e_job
+		{
+			JOB_CLASSIFY,
+			JOB_COLLECT,
+			JOB_LOCATE
+		};
+
+		std::vector<Worker>		_workers;
+		pthread_mutex_t			_lock;
+		pthread_cond_t			_wake;
+		pthread_cond_t			_done;
+		unsigned int			_generation;
+		unsigned int			_busy;
+		bool					_stopping;
+
+		// the job being run
+		e_job					_job;
+		const TriangleQuery*	_triangle;
+		const TriangleGrid*		_grid;
+		PointSpan				_points;
+		unsigned char*			_inside;
+		long*					_located;
+
+		ParallelBsp(const ParallelBsp& copy);
+		ParallelBsp&	operator=(const ParallelBsp& src);
+
+		static void*	_workerRoutine(void* arg);
+		size_t			_run(void);
+		void			_work(Worker& worker);
+		bool			_take(Worker& worker, unsigned int& task);
+		bool			_steal(Worker& worker, unsigned int& task);
+		void			_runTask(Worker& worker, unsigned int task);
+
+	public:
+		// threads == 0: one per online CPU
+		ParallelBsp(unsigned int threads = 0);
+		~ParallelBsp(void);
+
+		unsigned int	threads(void) const;
+		size_t			steals(void) const;		// during the last call
+
+		size_t	classify(const TriangleQuery& triangle, const PointSpan& points, unsigned char* inside);
+		size_t	collect(const TriangleQuery& triangle, const PointSpan& points, std::vector<size_t>& inside);
+		size_t	locate(const TriangleGrid& grid, const PointSpan& points, long* triangle);
+};
+
+#endif
@@ -13,6 +13,7 @@ class	Point
 		Point(void);
 		Point(const Point& copy);
 		Point(const float f1, const float f2);
+		Point(const Fixed& f1, const Fixed& f2);
 
 		~Point(void);
 
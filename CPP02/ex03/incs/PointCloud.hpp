@@ -0,0 +1,102 @@
+#ifndef POINTCLOUD_HPP
+# define POINTCLOUD_HPP
+
+# include <cstddef>
+
+# include "Point.hpp"
+# include "FixedSpan.hpp"
+
+/*
+ * Structure-of-arrays storage for many points: the x and y raw bits live
+ * in two separate 32-byte aligned FixedVectors, so a geometry kernel loads
+ * 8 x's and 8 y's per AVX2 step without any shuffle. Point itself (const
+ * members, getters returning copies) cannot be stored or assigned in bulk;
+ * PointCloud hands Points out by value and takes them in by copy.
+ */
+
+/* Non owning view over a PointCloud range, the input of the bulk kernels */
+class	PointSpan
+{
+	private:
+		FixedSpan	_x;
+		FixedSpan	_y;
+
+	public:
+		PointSpan(void);
+		PointSpan(const FixedSpan& x, const FixedSpan& y);
+		PointSpan(const PointSpan& copy);
+
+		~PointSpan(void);
+
+		PointSpan&	operator=(const PointSpan& src);
+
+		const FixedSpan&	xs(void) const;
+		const FixedSpan&	ys(void) const;
+		size_t				size(void) const;
+		PointSpan			subspan(size_t offset, size_t count) const;
+
+		Point	get(size_t index) const;
+		void	set(size_t index, const Point& point);
+};
+
+class	PointCloud
+{
+	private:
+		FixedVector	_x;
+		FixedVector	_y;
+
+	public:
+		/* Forward iteration, yields Points by value */
+		class	const_iterator
+		{
+			private:
+				const int*	_x;
+				const int*	_y;
+
+			public:
+				const_iterator(void) : _x(NULL), _y(NULL) {}
+				const_iterator(const int* x, const int* y) : _x(x), _y(y) {}
+
+				Point			operator*(void) const;
+				const_iterator&	operator++(void)	{ ++this->_x; ++this->_y; return (*this); }
+				const_iterator	operator++(int)		{ const_iterator old(*this); ++*this; return (old); }
+				bool			operator==(const const_iterator& rhs) const	{ return (this->_x == rhs._x); }
+				bool			operator!=(const const_iterator& rhs) const	{ return (this->_x != rhs._x); }
+
+				int				rawX(void) const	{ return (*this->_x); }
+				int				rawY(void) const	{ return (*this->_y); }
+		};
+
+		PointCloud(void);
+		PointCloud(size_t size);
+		PointCloud(const PointCloud& copy);
+
+		~PointCloud(void);
+
+		PointCloud&	operator=(const PointCloud& src);
+
+		size_t		size(void) const;
+		bool		empty(void) const;
+		void		reserve(size_t capacity);
+		void		resize(size_t size);
+		void		clear(void);
+
+		Point		get(size_t index) const;
+		void		set(size_t index, const Point& point);
+		void		push_back(const Point& point);
+
+		// bulk appends: count points each
+		void		append(const Point* points, size_t count);
+		void		appendRaw(const int* x, const int* y, size_t count);
+		void		appendFloat(const float* x, const float* y, size_t count);
+
+		PointSpan	view(void);
+		PointSpan	view(size_t offset, size_t count);
+		const int*	rawX(void) const;
+		const int*	rawY(void) const;
+
+		const_iterator	begin(void) const;
+		const_iterator	end(void) const;
+};
+
+#endif
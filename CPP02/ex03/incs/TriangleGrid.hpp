@@ -0,0 +1,61 @@
+#ifndef TRIANGLEGRID_HPP
+# define TRIANGLEGRID_HPP
+
+# include <cstddef>
+# include <vector>
+
+# include "TriangleQuery.hpp"
+
+/*
+ * Uniform grid over a set of triangles, to find the triangle(s) that
+ * strictly contain a point (same rule as bsp()) without testing them all.
+ *
+ * Cells are square, a power of two raw units wide, sized so that there are
+ * about two cells per triangle. Each triangle is listed in every cell its
+ * bounding box touches; the lists are packed in one array (cell c owns
+ * _items[_cellStart[c] .. _cellStart[c + 1])). A query maps the point to
+ * its cell with one shift per axis and runs TriangleQuery on that list
+ * only: O(1) on a mesh of evenly sized triangles.
+ */
+class	TriangleGrid
+{
+	private:
+		std::vector<TriangleQuery>	_triangles;
+		std::vector<unsigned int>	_cellStart;
+		std::vector<unsigned int>	_items;
+		int							_minX;
+		int							_minY;
+		unsigned int				_columns;
+		unsigned int				_rows;
+		int							_shift;
+
+		bool	_cellOf(int x, int y, size_t& cell) const;
+
+	public:
+		TriangleGrid(void);
+		TriangleGrid(const TriangleGrid& copy);
+
+		~TriangleGrid(void);
+
+		TriangleGrid&	operator=(const TriangleGrid& src);
+
+		// vertices holds 3 * triangleCount points, a triangle per 3
+		void	build(const Point* vertices, size_t triangleCount);
+		void	clear(void);
+
+		size_t	size(void) const;
+		size_t	cellCount(void) const;
+		size_t	itemCount(void) const;
+
+		// index of the first triangle containing the point, -1 if none
+		long	find(const Point& point) const;
+		long	findRaw(int x, int y) const;
+		// appends every containing triangle to out, returns how many
+		size_t	findAll(const Point& point, std::vector<size_t>& out) const;
+		// triangle[i] = find(i-th point) over min(xs.size(), ys.size()),
+		// returns how many points were found in a triangle
+		size_t	find(const FixedSpan& xs, const FixedSpan& ys, long* triangle) const;
+		size_t	find(const PointSpan& points, long* triangle) const;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef TRIANGLEQUERY_HPP
+# define TRIANGLEQUERY_HPP
+
+# include <cstddef>
+
+# include "Point.hpp"
+# include "FixedSpan.hpp"
+# include "PointCloud.hpp"
+
+/*
+ * Point-in-triangle for many points against one triangle, with the same
+ * rule as bsp(): true only strictly inside, false on an edge or a vertex
+ * and for a degenerate (flat) triangle.
+ *
+ * The constructor orders the vertices counter-clockwise and keeps their
+ * raw bits. A point is then inside when the three edge functions
+ *   E(p) = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x)
+ * are all > 0, and strictly inside the bounding box. That is exact integer
+ * arithmetic on the raw bits, with no division and no rounding, so unlike
+ * bsp()'s barycentric weights, which are rounded to 1/256, it cannot
+ * misclassify a point close to an edge (bsp() does for ~0.3% of random
+ * points on a 0.01 grid in [-10, 10]).
+ *
+ * Inside the bounding box every difference fits in 32 bits as long as the
+ * box is narrower than 2^31 raw (8388608.0), and the products fit in 64:
+ * classify() then runs 8 points per step with AVX2. Wider triangles, and
+ * builds without AVX2, take the scalar path (128-bit for wide triangles).
+ */
+class	TriangleQuery
+{
+	private:
+		int		_x[3];
+		int		_y[3];
+		int		_minX;
+		int		_maxX;
+		int		_minY;
+		int		_maxY;
+		bool	_degenerate;
+		bool	_wide;
+
+		bool	_containsWide(int x, int y) const;
+
+	public:
+		TriangleQuery(void);
+		TriangleQuery(const Point& a, const Point& b, const Point& c);
+		TriangleQuery(const TriangleQuery& copy);
+
+		~TriangleQuery(void);
+
+		TriangleQuery&	operator=(const TriangleQuery& src);
+
+		bool	degenerate(void) const;
+		bool	contains(const Point& point) const;
+		bool	containsRaw(int x, int y) const;
+
+		// inside[i] = 1 or 0 for the first min(xs.size(), ys.size()) points,
+		// returns how many are inside
+		size_t	classify(const FixedSpan& xs, const FixedSpan& ys, unsigned char* inside) const;
+		size_t	classify(const PointSpan& points, unsigned char* inside) const;
+};
+
+#endif
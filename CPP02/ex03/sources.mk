@@ -1,10 +1,34 @@
 override SRCSDIR	:= srcs/
 override SRCS		= $(addprefix $(SRCSDIR), $(SRC))
+override BENCH_SRCS	= $(addprefix $(SRCSDIR), $(addsuffix .cpp, $(LIB) $(BENCH_MAIN)))
 
-SRC	+= $(addsuffix .cpp, $(MAIN))
+SRC	+= $(addsuffix .cpp, $(LIB) $(MAIN))
 
-override MAIN			:= \
+override LIB			:= \
 	Point \
-	main \
+	PointCloud \
 	Fixed \
-	bsp
+	FixedDecimal \
+	FixedDivisor \
+	FixedMath \
+	FixedSpan \
+	ParallelBsp \
+	TriangleGrid \
+	TriangleQuery \
+	bsp \
+
+override MAIN			:= \
+	main \
+
+override BENCH_MAIN		:= \
+	bench/Bench \
+	bench/benchConvert \
+	bench/benchDecimal \
+	bench/benchDivision \
+	bench/benchIndex \
+	bench/benchKernels \
+	bench/benchMath \
+	bench/benchOperators \
+	bench/benchParallel \
+	bench/benchQuery \
+	bench/main \
@@ -113,74 +113,75 @@ bool	Fixed::operator!=(const Fixed& className) const
 
 /*  Arithmetic  */
 
+/*
+ * The messages are kept, but out of the hot path: the checks are single
+ * overflow-flag tests and the iostream code lives in a cold, never inlined
+ * function. For branch-free arithmetic see the policies of FixedPoint.hpp.
+ */
+static Fixed	overflowed(const char* message) __attribute__((cold, noinline));
+
+static Fixed	overflowed(const char* message)
+{
+	std::cout << message;
+	return (Fixed(0));
+}
+
 Fixed Fixed::operator+(const Fixed& className) const
 {
-    if ((_fixedPointValue > 0 && className.getRawBits() > INT_MAX - _fixedPointValue) ||
-        (_fixedPointValue < 0 && className.getRawBits() < INT_MIN - _fixedPointValue))
-	{
-        std::cout << "Overflow detected in addition, return: ";
-        return Fixed(0);
-    }
+	int	raw;
 
-    Fixed ret;
+	if (__builtin_expect(__builtin_add_overflow(_fixedPointValue, className.getRawBits(), &raw), 0))
+		return (overflowed("Overflow detected in addition, return: "));
 
-    ret.setRawBits(_fixedPointValue + className.getRawBits());
-    return (ret);
+	Fixed ret;
+
+	ret.setRawBits(raw);
+	return (ret);
 }
 
 Fixed	Fixed::operator-(const Fixed& className) const
 {
-    if ((_fixedPointValue > 0 && className.getRawBits() < _fixedPointValue - INT_MAX) ||
-        (_fixedPointValue < 0 && className.getRawBits() > _fixedPointValue - INT_MIN))
-	{
-        std::cout << "Overflow detected in subtraction, return: ";
-        return Fixed(0);
-    }
+	int	raw;
 
-    Fixed ret;
+	if (__builtin_expect(__builtin_sub_overflow(_fixedPointValue, className.getRawBits(), &raw), 0))
+		return (overflowed("Overflow detected in subtraction, return: "));
 
-    ret.setRawBits(_fixedPointValue - className.getRawBits());
-    return (ret);
+	Fixed ret;
+
+	ret.setRawBits(raw);
+	return (ret);
 }
 
 Fixed	Fixed::operator*(const Fixed& className) const
 {
 	long long int	resChecked;
 
-	resChecked = (((long)this->getRawBits() * className.getRawBits()) >> _fractionalBits);
+	resChecked = (((long long)this->getRawBits() * className.getRawBits()) >> _fractionalBits);
+
+	if (__builtin_expect(resChecked > INT_MAX || resChecked < INT_MIN, 0))
+		return (overflowed("Overflow detected in multiplication, return: "));
 
-	if (resChecked > INT_MAX || resChecked < INT_MIN)
-	{
-		std::cout << "Overflow detected in multiplication, return: ";
-		return (Fixed(0));
-	}
 	Fixed ret;
 
-    ret.setRawBits((this->getRawBits() * className.getRawBits()) >> _fractionalBits);
-    return (ret);
+	// the 64-bit product is the result, redoing it in int could overflow before the shift
+	ret.setRawBits(static_cast<int>(resChecked));
+	return (ret);
 }
 
 Fixed	Fixed::operator/(const Fixed& className) const
 {
+	if (__builtin_expect(className.getRawBits() == 0, 0))
+		return (overflowed("Division by 0 is impossible, return: "));
 
-	if (className.getRawBits() == 0)
-	{
-		std::cout << "Division by 0 is impossible, return: ";
-        return (Fixed(0));
-    }
-
-	long resChecked;
+	long long	resChecked;
 
-	resChecked = (((long)this->getRawBits() << _fractionalBits) / className.getRawBits());
-	if (resChecked > INT_MAX || resChecked < INT_MIN)
-	{
-		std::cout << "Overflow detected in division, return: ";
-		return (Fixed(0));
-	}
+	resChecked = (((long long)this->getRawBits() << _fractionalBits) / className.getRawBits());
+	if (__builtin_expect(resChecked > INT_MAX || resChecked < INT_MIN, 0))
+		return (overflowed("Overflow detected in division, return: "));
 
     Fixed ret;
 
-    ret.setRawBits((this->getRawBits() << _fractionalBits) / className.getRawBits());
+    ret.setRawBits(static_cast<int>(resChecked));
     return (ret);
 }
 
@@ -0,0 +1,120 @@
+#include "FixedDecimal.hpp"
+
+/*
+ * parse() keeps 16 fractional digits. Digits past that cannot move a value
+ * across a half unit, since 10^16 is even and ties round away from zero,
+ * so they are read and ignored.
+ */
+#define PARSE_SCALE_MAX	10000000000000000ULL
+
+static const char	g_digitPairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* Writes value right-aligned so that it ends just before end, returns the new start */
+static char*	writeInteger(unsigned int value, char* end)
+{
+	while (value >= 100)
+	{
+		const unsigned int	pair = (value % 100) * 2;
+
+		value /= 100;
+		*--end = g_digitPairs[pair + 1];
+		*--end = g_digitPairs[pair];
+	}
+	if (value >= 10)
+	{
+		*--end = g_digitPairs[value * 2 + 1];
+		*--end = g_digitPairs[value * 2];
+	}
+	else
+		*--end = (char)('0' + value);
+	return (end);
+}
+
+size_t	FixedDecimal::format(const Fixed& value, char* buffer, size_t size)
+{
+	char				scratch[BUFFER_SIZE];
+	const int			raw = value.getRawBits();
+	const unsigned int	magnitude = raw < 0 ? 0u - (unsigned int)raw : (unsigned int)raw;
+	unsigned int		fraction = magnitude & 0xFF;
+	char*				start = writeInteger(magnitude >> 8, scratch + 9);
+	char*				end = scratch + 9;
+
+	if (raw < 0)
+		*--start = '-';
+	if (fraction != 0)
+	{
+		// each x10 shifts one exact decimal digit above the 8 fractional bits
+		*end++ = '.';
+		while (fraction != 0)
+		{
+			fraction *= 10;
+			*end++ = (char)('0' + (fraction >> 8));
+			fraction &= 0xFF;
+		}
+	}
+
+	const size_t	length = end - start;
+
+	if (length + 1 > size)
+		return (0);
+	for (size_t i = 0; i < length; i++)
+		buffer[i] = start[i];
+	buffer[length] = '\0';
+	return (length);
+}
+
+size_t	FixedDecimal::parse(const char* str, Fixed& out)
+{
+	const char*			cursor = str;
+	bool				negative = false;
+	unsigned long long	integer = 0;
+	unsigned long long	fraction = 0;
+	unsigned long long	scale = 1;			// 10^(digits kept in fraction)
+	size_t				digits = 0;
+
+	if (*cursor == '-' || *cursor == '+')
+		negative = (*cursor++ == '-');
+	for (; *cursor >= '0' && *cursor <= '9'; cursor++, digits++)
+	{
+		integer = integer * 10 + (*cursor - '0');
+		if (integer > (1ULL << 24))
+			return (0);
+	}
+	if (*cursor == '.')
+	{
+		for (cursor++; *cursor >= '0' && *cursor <= '9'; cursor++, digits++)
+		{
+			if (scale < PARSE_SCALE_MAX)
+			{
+				fraction = fraction * 10 + (*cursor - '0');
+				scale *= 10;
+			}
+		}
+	}
+	if (digits == 0)
+		return (0);
+
+	// fraction / scale in 1/256 units, rounded half away from zero
+	const unsigned long long	scaled = fraction << 8;
+	unsigned long long			units = scaled / scale;
+	const unsigned long long	twice = (scaled % scale) * 2;
+
+	units += (twice >= scale);
+
+	const unsigned long long	magnitude = (integer << 8) + units;
+
+	if (magnitude > (negative ? 0x80000000ULL : 0x7FFFFFFFULL))
+		return (0);
+	out.setRawBits(negative ? (int)(0u - (unsigned int)magnitude) : (int)magnitude);
+	return (cursor - str);
+}
@@ -0,0 +1,72 @@
+#include "FixedDivisor.hpp"
+
+typedef unsigned __int128	u128;
+
+/* Constructors - Destructors */
+
+FixedDivisor::FixedDivisor(void) : _reciprocal(0), _magnitude(0), _negative(0) {}
+
+FixedDivisor::FixedDivisor(const Fixed& divisor) : _reciprocal(0), _magnitude(0), _negative(0)
+{
+	int	raw = divisor.getRawBits();
+
+	if (raw == 0)
+		return ;
+	this->_negative = raw < 0;
+	this->_magnitude = raw < 0 ? 0u - (unsigned int)raw : (unsigned int)raw;
+
+	const u128			d = this->_magnitude;
+	const u128			target = (u128)~0ull;		// 2^64 - 1
+	unsigned long long	m;
+
+	// initial estimate, good to ~53 bits
+	m = (unsigned long long)(18446744073709551615.0 / this->_magnitude * (1.0 - 1e-15));
+
+	// Newton-Raphson on the residual: m += m * (target - d * m) / 2^64
+	u128	product = d * m;
+
+	if (product <= target)
+		m += (unsigned long long)(((u128)m * (unsigned long long)(target - product)) >> 64);
+
+	// the refined value is within a couple of units: settle on the exact floor
+	while (d * m > target)
+		m--;
+	while (d * ((u128)m + 1) <= target)
+		m++;
+	this->_reciprocal = m;
+}
+
+FixedDivisor::FixedDivisor(const FixedDivisor& copy)
+	: _reciprocal(copy._reciprocal), _magnitude(copy._magnitude), _negative(copy._negative) {}
+
+FixedDivisor::~FixedDivisor(void) {}
+
+FixedDivisor&	FixedDivisor::operator=(const FixedDivisor& src)
+{
+	this->_reciprocal = src._reciprocal;
+	this->_magnitude = src._magnitude;
+	this->_negative = src._negative;
+	return (*this);
+}
+
+
+
+/* Division */
+
+Fixed	FixedDivisor::divide(const Fixed& dividend) const
+{
+	Fixed	result;
+
+	result.setRawBits(this->divideRaw(dividend.getRawBits()));
+	return (result);
+}
+
+/* Divides every element of the span in place */
+void	FixedDivisor::divide(FixedSpan span) const
+{
+	int*	data = span.data();
+	size_t	size = span.size();
+
+	for (size_t i = 0; i < size; i++)
+		data[i] = this->divideRaw(data[i]);
+}
@@ -0,0 +1,266 @@
+#include <climits>
+
+#include "FixedMath.hpp"
+
+typedef unsigned __int128	u128;
+typedef __int128			i128;
+
+/* Constants, rounded to nearest */
+#define CORDIC_STEPS	30
+#define CORDIC_GAIN_30	652032874LL			// prod 1/sqrt(1 + 2^-2i), 2.30
+#define PI_30			3373259426LL
+#define HALF_PI_30		1686629713LL
+#define TWO_PI_32		26986075409LL
+#define TWO_PI_LOW_64	189141414LL			// 2pi - TWO_PI_32, in 64 fractional bits
+#define LOG2E_62		6653256548922161246LL
+#define LN2_30			744261118LL
+#define LN2_62			3196577161300663915ULL
+
+static const long long	g_atan30[CORDIC_STEPS] = {	// atan(2^-i), 2.30
+	843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851,
+	8388437, 4194283, 2097149, 1048576, 524288, 262144, 131072, 65536, 32768,
+	16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4, 2
+};
+
+#define EXP_TERMS	20
+
+static const unsigned long long	g_invFactorial62[EXP_TERMS + 1] = {	// 1/n!, 0.62
+	4611686018427387904ULL, 4611686018427387904ULL, 2305843009213693952ULL,
+	768614336404564651ULL, 192153584101141163ULL, 38430716820228233ULL,
+	6405119470038039ULL, 915017067148291ULL, 114377133393536ULL,
+	12708570377060ULL, 1270857037706ULL, 115532457973ULL, 9627704831ULL,
+	740592679ULL, 52899477ULL, 3526632ULL, 220414ULL, 12966ULL, 720ULL,
+	38ULL, 2ULL
+};
+
+/* value when mask == 0, -value when mask == -1: no branch on the sign */
+static long long	applySign(long long value, long long mask)
+{
+	return ((value ^ mask) - mask);
+}
+
+static Fixed	fromRaw(long long raw)
+{
+	Fixed	result;
+
+	if (raw > INT_MAX)
+		raw = INT_MAX;
+	if (raw < INT_MIN)
+		raw = INT_MIN;
+	result.setRawBits((int)raw);
+	return (result);
+}
+
+/* 2.30 -> 24.8, rounded to nearest */
+static long long	round30(long long value)
+{
+	return ((value + (1LL << 21)) >> 22);
+}
+
+
+
+/* sqrt / reciprocal */
+
+Fixed	FixedMath::sqrt(const Fixed& x)
+{
+	if (x.getRawBits() <= 0)
+		return (Fixed(0));
+
+	// sqrt(r / 256) * 256 == sqrt(r * 256): one integer square root
+	unsigned long long	n = (unsigned long long)x.getRawBits() << 8;
+	unsigned long long	root = 0;
+	unsigned long long	bit = 1ULL << 38;
+
+	while (bit > n)
+		bit >>= 2;
+	while (bit != 0)
+	{
+		// the digit test is a coin flip: select with a mask, not a branch
+		unsigned long long	trial = root + bit;
+		unsigned long long	take = -(unsigned long long)(n >= trial);
+
+		n -= trial & take;
+		root = (root >> 1) + (bit & take);
+		bit >>= 2;
+	}
+	// n is now the remainder r*256 - root^2: round up past (root + 1/2)^2
+	return (fromRaw(root + (n > root)));
+}
+
+Fixed	FixedMath::reciprocal(const Fixed& x)
+{
+	long long	raw = x.getRawBits();
+
+	if (raw == 0)
+		return (Fixed(0));
+
+	long long	magnitude = raw < 0 ? -raw : raw;
+	long long	q = ((1LL << 16) + magnitude / 2) / magnitude;
+
+	return (fromRaw(raw < 0 ? -q : q));
+}
+
+
+
+/* Trigonometry (CORDIC) */
+
+void	FixedMath::sincos(const Fixed& x, Fixed& sinOut, Fixed& cosOut)
+{
+	// reduce to [-pi, pi] in 32 fractional bits, then to [-pi/2, pi/2]; the
+	// low bits of 2pi matter once k turns reach ~2^20 (|x| near 2^23)
+	const long long	scaled = (long long)x.getRawBits() << 24;
+	const long long	turns = scaled / TWO_PI_32;
+	long long		angle = scaled - turns * TWO_PI_32 - ((turns * TWO_PI_LOW_64 + (1LL << 31)) >> 32);
+
+	if (angle > TWO_PI_32 / 2)
+		angle -= TWO_PI_32;
+	else if (angle < -TWO_PI_32 / 2)
+		angle += TWO_PI_32;
+	angle >>= 2;
+
+	int	cosSign = 1;
+
+	if (angle > HALF_PI_30)
+	{
+		angle = PI_30 - angle;
+		cosSign = -1;
+	}
+	else if (angle < -HALF_PI_30)
+	{
+		angle = -PI_30 - angle;
+		cosSign = -1;
+	}
+
+	long long	cx = CORDIC_GAIN_30;
+	long long	sy = 0;
+
+	// the rotation direction is data dependent: keep it out of the branch predictor
+	for (int i = 0; i < CORDIC_STEPS; i++)
+	{
+		long long	dx = sy >> i;
+		long long	dy = cx >> i;
+		long long	mask = angle >> 63;	// 0 rotates up, -1 rotates down
+
+		cx -= applySign(dx, mask);
+		sy += applySign(dy, mask);
+		angle -= applySign(g_atan30[i], mask);
+	}
+	sinOut = fromRaw(round30(sy));
+	cosOut = fromRaw(round30(cx) * cosSign);
+}
+
+Fixed	FixedMath::sin(const Fixed& x)
+{
+	Fixed	s;
+	Fixed	c;
+
+	sincos(x, s, c);
+	return (s);
+}
+
+Fixed	FixedMath::cos(const Fixed& x)
+{
+	Fixed	s;
+	Fixed	c;
+
+	sincos(x, s, c);
+	return (c);
+}
+
+Fixed	FixedMath::atan2(const Fixed& y, const Fixed& x)
+{
+	long long	vx = x.getRawBits();
+	long long	vy = y.getRawBits();
+	long long	angle = 0;
+
+	if (vx == 0 && vy == 0)
+		return (Fixed(0));
+	if (vx < 0)
+	{
+		angle = vy >= 0 ? PI_30 : -PI_30;
+		vx = -vx;
+		vy = -vy;
+	}
+
+	// scale up so that the shifts below keep ~30 significant bits
+	long long	magnitude = vx > (vy < 0 ? -vy : vy) ? vx : (vy < 0 ? -vy : vy);
+
+	while (magnitude < (1LL << 29))
+	{
+		magnitude <<= 1;
+		vx <<= 1;
+		vy <<= 1;
+	}
+	for (int i = 0; i < CORDIC_STEPS; i++)
+	{
+		long long	dx = vy >> i;
+		long long	dy = vx >> i;
+		long long	mask = (vy - 1) >> 63;	// 0 while vy > 0, -1 otherwise
+
+		vx += applySign(dx, mask);
+		vy -= applySign(dy, mask);
+		angle += applySign(g_atan30[i], mask);
+	}
+	return (fromRaw(round30(angle)));
+}
+
+
+
+/* exp / log */
+
+/*
+ * e^x = 2^k * e^g with k = floor(x * log2(e)) and g = frac * ln(2) in
+ * [0, ln 2): a 20-term Taylor series in 0.62 (Horner) gives e^g to ~2^-62, results
+ * up to 2^31 raw need ~33 good bits.
+ */
+Fixed	FixedMath::exp(const Fixed& x)
+{
+	i128		t = (i128)x.getRawBits() * LOG2E_62;	// x * log2(e), 70 fractional bits
+	long long	k = (long long)(t >> 70);
+
+	if (k >= 23)
+		return (fromRaw(LLONG_MAX));
+	if (k < -9)		// below 2^-9 the result rounds to 0
+		return (Fixed(0));
+
+	unsigned long long	frac = (unsigned long long)((t - ((i128)k << 70)) >> 8);	// 0.62
+	unsigned long long	g = (unsigned long long)(((u128)frac * LN2_62) >> 62);
+	unsigned long long	p = g_invFactorial62[EXP_TERMS];
+
+	// Horner on the 1/n! table: no division in the loop
+	for (int n = EXP_TERMS - 1; n >= 0; n--)
+		p = g_invFactorial62[n] + (unsigned long long)(((u128)g * p) >> 62);
+
+	// p is e^g in 62 fractional bits, the result needs 8: shift by 54 - k
+	const int			shift = 54 - (int)k;
+	unsigned long long	rounded = (p + (1ULL << (shift - 1))) >> shift;
+
+	return (fromRaw((long long)rounded));
+}
+
+/*
+ * ln(x) = (e - 8) * ln(2) + ln(m) with x.raw = 2^e * m, m in [1, 2), and
+ * ln(m) = 2 atanh(s), s = (m - 1) / (m + 1) < 1/3, summed up to s^21.
+ */
+Fixed	FixedMath::log(const Fixed& x)
+{
+	long long	raw = x.getRawBits();
+
+	if (raw <= 0)
+		return (fromRaw(INT_MIN));
+
+	int	e = 63 - __builtin_clzll((unsigned long long)raw);
+
+	long long	m = raw << (30 - e);						// 1.30
+	long long	s = ((m - (1LL << 30)) << 30) / (m + (1LL << 30));
+	long long	s2 = (s * s) >> 30;
+	long long	term = s;
+	long long	sum = s;
+
+	for (int k = 3; k <= 21; k += 2)
+	{
+		term = (term * s2) >> 30;
+		sum += term / k;
+	}
+	return (fromRaw(round30((e - 8) * LN2_30 + 2 * sum)));
+}
@@ -0,0 +1,430 @@
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#if defined(__SSE2__)
+# include <immintrin.h>
+#endif
+
+#include "FixedSpan.hpp"
+
+#define RAW_SHIFT	8	// Fixed::_fractionalBits
+
+/* Constructors - Destructors */
+
+FixedSpan::FixedSpan(void) : _data(NULL), _size(0) {}
+
+FixedSpan::FixedSpan(int* data, size_t size) : _data(data), _size(size) {}
+
+FixedSpan::FixedSpan(const FixedSpan& copy) : _data(copy._data), _size(copy._size) {}
+
+FixedSpan::~FixedSpan(void) {}
+
+FixedSpan&	FixedSpan::operator=(const FixedSpan& src)
+{
+	this->_data = src._data;
+	this->_size = src._size;
+	return (*this);
+}
+
+
+
+/* Accessors */
+
+int*	FixedSpan::data(void) const
+{
+	return (this->_data);
+}
+
+size_t	FixedSpan::size(void) const
+{
+	return (this->_size);
+}
+
+FixedSpan	FixedSpan::subspan(size_t offset, size_t count) const
+{
+	if (offset > this->_size)
+		offset = this->_size;
+	if (count > this->_size - offset)
+		count = this->_size - offset;
+	return (FixedSpan(this->_data + offset, count));
+}
+
+Fixed	FixedSpan::get(size_t index) const
+{
+	Fixed	value;
+
+	value.setRawBits(this->_data[index]);
+	return (value);
+}
+
+void	FixedSpan::set(size_t index, const Fixed& value)
+{
+	this->_data[index] = value.getRawBits();
+}
+
+
+
+/* Scalar helpers, also used for the tails of the SIMD loops */
+
+static inline int	wrapAdd(int a, int b)
+{
+	return ((int)((unsigned int)a + (unsigned int)b));
+}
+
+static inline int	wrapSub(int a, int b)
+{
+	return ((int)((unsigned int)a - (unsigned int)b));
+}
+
+static inline int	fixedMul(int a, int b)
+{
+	return ((int)(((long long)a * b) >> RAW_SHIFT));
+}
+
+#if defined(__AVX2__)
+/* Low 32 bits of (a * b) >> 8 for 8 lanes: even and odd lanes widen separately */
+static inline __m256i	mulLanes(__m256i a, __m256i b)
+{
+	__m256i	even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), RAW_SHIFT);
+	__m256i	odd = _mm256_srli_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+		_mm256_srli_epi64(b, 32)), RAW_SHIFT);
+
+	return (_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA));
+}
+#elif defined(__SSE4_1__)
+static inline __m128i	mulLanes(__m128i a, __m128i b)
+{
+	__m128i	even = _mm_srli_epi64(_mm_mul_epi32(a, b), RAW_SHIFT);
+	__m128i	odd = _mm_srli_epi64(_mm_mul_epi32(_mm_srli_epi64(a, 32),
+		_mm_srli_epi64(b, 32)), RAW_SHIFT);
+
+	return (_mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC));
+}
+#endif
+
+
+
+/* Bulk operations */
+
+void	FixedSpan::add(const FixedSpan& rhs)
+{
+	size_t		n = this->_size < rhs._size ? this->_size : rhs._size;
+	int*		a = this->_data;
+	const int*	b = rhs._data;
+	size_t		i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 8 <= n; i += 8)
+		_mm256_storeu_si256((__m256i*)(a + i), _mm256_add_epi32(
+			_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i))));
+#elif defined(__SSE2__)
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_si128((__m128i*)(a + i), _mm_add_epi32(
+			_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i))));
+#endif
+	for (; i < n; i++)
+		a[i] = wrapAdd(a[i], b[i]);
+}
+
+void	FixedSpan::sub(const FixedSpan& rhs)
+{
+	size_t		n = this->_size < rhs._size ? this->_size : rhs._size;
+	int*		a = this->_data;
+	const int*	b = rhs._data;
+	size_t		i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 8 <= n; i += 8)
+		_mm256_storeu_si256((__m256i*)(a + i), _mm256_sub_epi32(
+			_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i))));
+#elif defined(__SSE2__)
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_si128((__m128i*)(a + i), _mm_sub_epi32(
+			_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i))));
+#endif
+	for (; i < n; i++)
+		a[i] = wrapSub(a[i], b[i]);
+}
+
+void	FixedSpan::mul(const FixedSpan& rhs)
+{
+	size_t		n = this->_size < rhs._size ? this->_size : rhs._size;
+	int*		a = this->_data;
+	const int*	b = rhs._data;
+	size_t		i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 8 <= n; i += 8)
+		_mm256_storeu_si256((__m256i*)(a + i), mulLanes(
+			_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i))));
+#elif defined(__SSE4_1__)
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_si128((__m128i*)(a + i), mulLanes(
+			_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i))));
+#endif
+	for (; i < n; i++)
+		a[i] = fixedMul(a[i], b[i]);
+}
+
+void	FixedSpan::scale(const Fixed& factor)
+{
+	size_t	n = this->_size;
+	int*	a = this->_data;
+	int		f = factor.getRawBits();
+	size_t	i = 0;
+
+#if defined(__AVX2__)
+	const __m256i	f8 = _mm256_set1_epi32(f);
+
+	for (; i + 8 <= n; i += 8)
+		_mm256_storeu_si256((__m256i*)(a + i), mulLanes(_mm256_loadu_si256((const __m256i*)(a + i)), f8));
+#elif defined(__SSE4_1__)
+	const __m128i	f4 = _mm_set1_epi32(f);
+
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_si128((__m128i*)(a + i), mulLanes(_mm_loadu_si128((const __m128i*)(a + i)), f4));
+#endif
+	for (; i < n; i++)
+		a[i] = fixedMul(a[i], f);
+}
+
+/* Sum of the exact 64-bit products, in 48.16 (wraps only past 2^63) */
+long long	FixedSpan::dotRaw(const FixedSpan& rhs) const
+{
+	size_t				n = this->_size < rhs._size ? this->_size : rhs._size;
+	const int*			a = this->_data;
+	const int*			b = rhs._data;
+	unsigned long long	sum = 0;
+	size_t				i = 0;
+
+#if defined(__AVX2__)
+	__m256i	acc = _mm256_setzero_si256();
+
+	for (; i + 8 <= n; i += 8)
+	{
+		__m256i	va = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i	vb = _mm256_loadu_si256((const __m256i*)(b + i));
+
+		acc = _mm256_add_epi64(acc, _mm256_mul_epi32(va, vb));
+		acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32)));
+	}
+
+	unsigned long long	lanes[4];
+
+	_mm256_storeu_si256((__m256i*)lanes, acc);
+	sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE4_1__)
+	__m128i	acc = _mm_setzero_si128();
+
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128i	va = _mm_loadu_si128((const __m128i*)(a + i));
+		__m128i	vb = _mm_loadu_si128((const __m128i*)(b + i));
+
+		acc = _mm_add_epi64(acc, _mm_mul_epi32(va, vb));
+		acc = _mm_add_epi64(acc, _mm_mul_epi32(_mm_srli_epi64(va, 32), _mm_srli_epi64(vb, 32)));
+	}
+
+	unsigned long long	lanes[2];
+
+	_mm_storeu_si128((__m128i*)lanes, acc);
+	sum = lanes[0] + lanes[1];
+#endif
+	for (; i < n; i++)
+		sum += (unsigned long long)((long long)a[i] * b[i]);
+	return ((long long)sum);
+}
+
+/*
+ * roundf() rounds half away from zero, cvtps2dq rounds half to even: the
+ * SIMD paths truncate instead, then step one unit away from zero when the
+ * dropped fraction (exact in float) is at least one half.
+ */
+#if defined(__AVX2__)
+static inline __m256i	roundLanes(__m256 v)
+{
+	const __m256	absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+	__m256i			t = _mm256_cvttps_epi32(v);
+	__m256			frac = _mm256_and_ps(_mm256_sub_ps(v, _mm256_cvtepi32_ps(t)), absMask);
+	__m256i			away = _mm256_or_si256(_mm256_srai_epi32(_mm256_castps_si256(v), 31), _mm256_set1_epi32(1));
+	__m256i			half = _mm256_castps_si256(_mm256_cmp_ps(frac, _mm256_set1_ps(0.5f), _CMP_GE_OQ));
+
+	return (_mm256_add_epi32(t, _mm256_and_si256(half, away)));
+}
+#elif defined(__SSE2__)
+static inline __m128i	roundLanes(__m128 v)
+{
+	const __m128	absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128i			t = _mm_cvttps_epi32(v);
+	__m128			frac = _mm_and_ps(_mm_sub_ps(v, _mm_cvtepi32_ps(t)), absMask);
+	__m128i			away = _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(v), 31), _mm_set1_epi32(1));
+	__m128i			half = _mm_castps_si128(_mm_cmpge_ps(frac, _mm_set1_ps(0.5f)));
+
+	return (_mm_add_epi32(t, _mm_and_si128(half, away)));
+}
+#endif
+
+/* Fills the span with Fixed(src[i]) */
+void	FixedSpan::fromFloat(const float* src)
+{
+	size_t	n = this->_size;
+	int*	out = this->_data;
+	size_t	i = 0;
+
+#if defined(__AVX2__)
+	const __m256	scale = _mm256_set1_ps((float)(1 << RAW_SHIFT));
+
+	for (; i + 8 <= n; i += 8)
+		_mm256_storeu_si256((__m256i*)(out + i), roundLanes(_mm256_mul_ps(_mm256_loadu_ps(src + i), scale)));
+#elif defined(__SSE2__)
+	const __m128	scale = _mm_set1_ps((float)(1 << RAW_SHIFT));
+
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_si128((__m128i*)(out + i), roundLanes(_mm_mul_ps(_mm_loadu_ps(src + i), scale)));
+#endif
+	for (; i < n; i++)
+		out[i] = (int)__builtin_roundf(src[i] * (1 << RAW_SHIFT));
+}
+
+/* dst[i] = get(i).toFloat(); dividing by 256 and multiplying by 1/256 are the same here */
+void	FixedSpan::toFloat(float* dst) const
+{
+	size_t		n = this->_size;
+	const int*	in = this->_data;
+	size_t		i = 0;
+
+#if defined(__AVX2__)
+	const __m256	scale = _mm256_set1_ps(1.0f / (1 << RAW_SHIFT));
+
+	for (; i + 8 <= n; i += 8)
+		_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(
+			_mm256_loadu_si256((const __m256i*)(in + i))), scale));
+#elif defined(__SSE2__)
+	const __m128	scale = _mm_set1_ps(1.0f / (1 << RAW_SHIFT));
+
+	for (; i + 4 <= n; i += 4)
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(
+			_mm_loadu_si128((const __m128i*)(in + i))), scale));
+#endif
+	for (; i < n; i++)
+		dst[i] = (float)in[i] / (1 << RAW_SHIFT);
+}
+
+Fixed	FixedSpan::dot(const FixedSpan& rhs) const
+{
+	Fixed	result;
+
+	result.setRawBits((int)(this->dotRaw(rhs) >> RAW_SHIFT));
+	return (result);
+}
+
+
+
+/* FixedVector */
+
+FixedVector::FixedVector(void) : _data(NULL), _size(0), _capacity(0) {}
+
+FixedVector::FixedVector(size_t size, const Fixed& value) : _data(NULL), _size(0), _capacity(0)
+{
+	this->resize(size, value);
+}
+
+FixedVector::FixedVector(const FixedVector& copy) : _data(NULL), _size(0), _capacity(0)
+{
+	*this = copy;
+}
+
+FixedVector::~FixedVector(void)
+{
+	free(this->_data);
+}
+
+FixedVector&	FixedVector::operator=(const FixedVector& src)
+{
+	if (this != &src)
+	{
+		this->_size = 0;
+		this->reserve(src._size);
+		if (src._size > 0)
+			memcpy(this->_data, src._data, src._size * sizeof(int));
+		this->_size = src._size;
+	}
+	return (*this);
+}
+
+void	FixedVector::_grow(size_t capacity)
+{
+	void*	block = NULL;
+
+	if (posix_memalign(&block, 32, capacity * sizeof(int)) != 0)
+		throw std::bad_alloc();
+	if (this->_size > 0)
+		memcpy(block, this->_data, this->_size * sizeof(int));
+	free(this->_data);
+	this->_data = static_cast<int*>(block);
+	this->_capacity = capacity;
+}
+
+void	FixedVector::reserve(size_t capacity)
+{
+	if (capacity > this->_capacity)
+		this->_grow(capacity);
+}
+
+void	FixedVector::resize(size_t size, const Fixed& value)
+{
+	this->reserve(size);
+	for (size_t i = this->_size; i < size; i++)
+		this->_data[i] = value.getRawBits();
+	this->_size = size;
+}
+
+void	FixedVector::push_back(const Fixed& value)
+{
+	if (this->_size == this->_capacity)
+		this->_grow(this->_capacity ? this->_capacity * 2 : 16);
+	this->_data[this->_size++] = value.getRawBits();
+}
+
+void	FixedVector::clear(void)
+{
+	this->_size = 0;
+}
+
+size_t	FixedVector::size(void) const
+{
+	return (this->_size);
+}
+
+size_t	FixedVector::capacity(void) const
+{
+	return (this->_capacity);
+}
+
+int*	FixedVector::data(void)
+{
+	return (this->_data);
+}
+
+const int*	FixedVector::data(void) const
+{
+	return (this->_data);
+}
+
+FixedSpan	FixedVector::span(void)
+{
+	return (FixedSpan(this->_data, this->_size));
+}
+
+Fixed	FixedVector::get(size_t index) const
+{
+	Fixed	value;
+
+	value.setRawBits(this->_data[index]);
+	return (value);
+}
+
+void	FixedVector::set(size_t index, const Fixed& value)
+{
+	this->_data[index] = value.getRawBits();
+}
@@ -0,0 +1,285 @@
+#include <unistd.h>
+
+#include "ParallelBsp.hpp"
+
+static unsigned long long	packRange(unsigned int begin, unsigned int end)
+{
+	return ((unsigned long long)end << 32 | begin);
+}
+
+static unsigned int	rangeBegin(unsigned long long range)
+{
+	return ((unsigned int)range);
+}
+
+static unsigned int	rangeEnd(unsigned long long range)
+{
+	return ((unsigned int)(range >> 32));
+}
+
+/* Constructors - Destructors */
+
+ParallelBsp::ParallelBsp(unsigned int threads)
+	: _generation(0), _busy(0), _stopping(false), _job(JOB_CLASSIFY), _triangle(NULL), _grid(NULL),
+	_inside(NULL), _located(NULL)
+{
+	if (threads == 0)
+	{
+		const long	online = sysconf(_SC_NPROCESSORS_ONLN);
+
+		threads = online > 0 ? (unsigned int)online : 1;
+	}
+	pthread_mutex_init(&this->_lock, NULL);
+	pthread_cond_init(&this->_wake, NULL);
+	pthread_cond_init(&this->_done, NULL);
+
+	// the Workers must not move once the threads hold pointers to them
+	this->_workers.resize(threads);
+	for (unsigned int i = 0; i < threads; i++)
+	{
+		this->_workers[i].range = 0;
+		this->_workers[i].pool = this;
+		this->_workers[i].index = i;
+		this->_workers[i].found = 0;
+		this->_workers[i].steals = 0;
+	}
+	for (unsigned int i = 1; i < threads; i++)
+	{
+		if (pthread_create(&this->_workers[i].thread, NULL, &ParallelBsp::_workerRoutine, &this->_workers[i]) != 0)
+		{
+			// run with the threads we got: their ranges only cover them
+			this->_workers.resize(i);
+			break ;
+		}
+	}
+}
+
+ParallelBsp::~ParallelBsp(void)
+{
+	pthread_mutex_lock(&this->_lock);
+	this->_stopping = true;
+	pthread_cond_broadcast(&this->_wake);
+	pthread_mutex_unlock(&this->_lock);
+	for (size_t i = 1; i < this->_workers.size(); i++)
+		pthread_join(this->_workers[i].thread, NULL);
+	pthread_cond_destroy(&this->_done);
+	pthread_cond_destroy(&this->_wake);
+	pthread_mutex_destroy(&this->_lock);
+}
+
+
+
+/* Accessors */
+
+unsigned int	ParallelBsp::threads(void) const
+{
+	return ((unsigned int)this->_workers.size());
+}
+
+size_t	ParallelBsp::steals(void) const
+{
+	size_t	total = 0;
+
+	for (size_t i = 0; i < this->_workers.size(); i++)
+		total += this->_workers[i].steals;
+	return (total);
+}
+
+
+
+/* Scheduling */
+
+bool	ParallelBsp::_take(Worker& worker, unsigned int& task)
+{
+	unsigned long long	range = __atomic_load_n(&worker.range, __ATOMIC_ACQUIRE);
+
+	while (rangeBegin(range) < rangeEnd(range))
+	{
+		const unsigned long long	next = packRange(rangeBegin(range) + 1, rangeEnd(range));
+
+		if (__atomic_compare_exchange_n(&worker.range, &range, next, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			task = rangeBegin(range);
+			return (true);
+		}
+	}
+	return (false);
+}
+
+bool	ParallelBsp::_steal(Worker& worker, unsigned int& task)
+{
+	const size_t	count = this->_workers.size();
+
+	for (size_t offset = 1; offset < count; offset++)
+	{
+		Worker&				victim = this->_workers[(worker.index + offset) % count];
+		unsigned long long	range = __atomic_load_n(&victim.range, __ATOMIC_ACQUIRE);
+
+		while (rangeBegin(range) < rangeEnd(range))
+		{
+			const unsigned int	begin = rangeBegin(range);
+			const unsigned int	end = rangeEnd(range);
+			const unsigned int	split = end - (end - begin + 1) / 2;
+
+			if (__atomic_compare_exchange_n(&victim.range, &range, packRange(begin, split),
+				false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			{
+				// our own range is empty, and nobody touches an empty range
+				__atomic_store_n(&worker.range, packRange(split + 1, end), __ATOMIC_RELEASE);
+				worker.steals++;
+				task = split;
+				return (true);
+			}
+		}
+	}
+	return (false);
+}
+
+void	ParallelBsp::_runTask(Worker& worker, unsigned int task)
+{
+	const size_t	first = (size_t)task * TASK_POINTS;
+	const PointSpan	points = this->_points.subspan(first, TASK_POINTS);
+
+	if (this->_job == JOB_CLASSIFY)
+		worker.found += this->_triangle->classify(points, this->_inside + first);
+	else if (this->_job == JOB_LOCATE)
+		worker.found += this->_grid->find(points, this->_located + first);
+	else
+	{
+		unsigned char	inside[TASK_POINTS];
+		const size_t	count = this->_triangle->classify(points, inside);
+		const size_t	offset = worker.indices.size();
+
+		for (size_t i = 0; i < points.size(); i++)
+			if (inside[i])
+				worker.indices.push_back(first + i);
+		worker.spans.push_back(task);
+		worker.spans.push_back(offset);
+		worker.spans.push_back(count);
+		worker.found += count;
+	}
+}
+
+void	ParallelBsp::_work(Worker& worker)
+{
+	unsigned int	task;
+
+	while (this->_take(worker, task) || this->_steal(worker, task))
+		this->_runTask(worker, task);
+}
+
+void*	ParallelBsp::_workerRoutine(void* arg)
+{
+	Worker&			worker = *static_cast<Worker*>(arg);
+	ParallelBsp&	pool = *worker.pool;
+	unsigned int	seen = 0;
+
+	pthread_mutex_lock(&pool._lock);
+	while (true)
+	{
+		while (pool._generation == seen && !pool._stopping)
+			pthread_cond_wait(&pool._wake, &pool._lock);
+		if (pool._stopping)
+			break ;
+		seen = pool._generation;
+		pthread_mutex_unlock(&pool._lock);
+
+		pool._work(worker);
+
+		pthread_mutex_lock(&pool._lock);
+		if (--pool._busy == 0)
+			pthread_cond_signal(&pool._done);
+	}
+	pthread_mutex_unlock(&pool._lock);
+	return (NULL);
+}
+
+/* Deals the tasks out evenly, runs worker 0 here and waits for the others */
+size_t	ParallelBsp::_run(void)
+{
+	const size_t		count = this->_workers.size();
+	const unsigned int	tasks = (unsigned int)((this->_points.size() + TASK_POINTS - 1) / TASK_POINTS);
+	size_t				found = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		Worker&	worker = this->_workers[i];
+
+		worker.range = packRange((unsigned int)(tasks * i / count), (unsigned int)(tasks * (i + 1) / count));
+		worker.found = 0;
+		worker.steals = 0;
+		worker.indices.clear();
+		worker.spans.clear();
+	}
+
+	pthread_mutex_lock(&this->_lock);
+	this->_busy = (unsigned int)count - 1;
+	this->_generation++;
+	pthread_cond_broadcast(&this->_wake);
+	pthread_mutex_unlock(&this->_lock);
+
+	this->_work(this->_workers[0]);
+
+	pthread_mutex_lock(&this->_lock);
+	while (this->_busy != 0)
+		pthread_cond_wait(&this->_done, &this->_lock);
+	pthread_mutex_unlock(&this->_lock);
+
+	for (size_t i = 0; i < count; i++)
+		found += this->_workers[i].found;
+	return (found);
+}
+
+
+
+/* Jobs */
+
+size_t	ParallelBsp::classify(const TriangleQuery& triangle, const PointSpan& points, unsigned char* inside)
+{
+	this->_job = JOB_CLASSIFY;
+	this->_triangle = &triangle;
+	this->_points = points;
+	this->_inside = inside;
+	return (this->_run());
+}
+
+size_t	ParallelBsp::locate(const TriangleGrid& grid, const PointSpan& points, long* triangle)
+{
+	this->_job = JOB_LOCATE;
+	this->_grid = &grid;
+	this->_points = points;
+	this->_located = triangle;
+	return (this->_run());
+}
+
+size_t	ParallelBsp::collect(const TriangleQuery& triangle, const PointSpan& points, std::vector<size_t>& inside)
+{
+	const unsigned int	tasks = (unsigned int)((points.size() + TASK_POINTS - 1) / TASK_POINTS);
+
+	this->_job = JOB_COLLECT;
+	this->_triangle = &triangle;
+	this->_points = points;
+
+	const size_t	found = this->_run();
+
+	// where each task's indices ended up, then concatenate in task order
+	std::vector<const size_t*>	source(tasks, (const size_t*)NULL);
+	std::vector<size_t>			length(tasks, 0);
+
+	for (size_t w = 0; w < this->_workers.size(); w++)
+	{
+		const Worker&	worker = this->_workers[w];
+
+		for (size_t s = 0; s < worker.spans.size(); s += 3)
+		{
+			if (worker.spans[s + 2] == 0)
+				continue ;
+			source[worker.spans[s]] = &worker.indices[worker.spans[s + 1]];
+			length[worker.spans[s]] = worker.spans[s + 2];
+		}
+	}
+	inside.reserve(inside.size() + found);
+	for (unsigned int t = 0; t < tasks; t++)
+		inside.insert(inside.end(), source[t], source[t] + length[t]);
+	return (found);
+}
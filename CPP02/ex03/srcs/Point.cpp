@@ -8,7 +8,7 @@ Point::Point(const Point& copy) : _x(copy._x), _y(copy._y) {}
 
 Point::Point(const float f1, const float f2) : _x(f1), _y(f2) {}
 
-// Point::Point(const Fixed& f1, const Fixed& f2): _x(f1), _y(f2) {} // pas encore sur si j'en ai besoin
+Point::Point(const Fixed& f1, const Fixed& f2) : _x(f1), _y(f2) {}
 
 Point&	Point::operator=(const Point& copy)
 {
@@ -0,0 +1,219 @@
+#include <cstring>
+
+#include "PointCloud.hpp"
+
+static Point	pointFromRaw(int x, int y)
+{
+	Fixed	fx;
+	Fixed	fy;
+
+	fx.setRawBits(x);
+	fy.setRawBits(y);
+	return (Point(fx, fy));
+}
+
+/* PointSpan */
+
+PointSpan::PointSpan(void) {}
+
+PointSpan::PointSpan(const FixedSpan& x, const FixedSpan& y)
+{
+	const size_t	n = x.size() < y.size() ? x.size() : y.size();
+
+	this->_x = x.subspan(0, n);
+	this->_y = y.subspan(0, n);
+}
+
+PointSpan::PointSpan(const PointSpan& copy) : _x(copy._x), _y(copy._y) {}
+
+PointSpan::~PointSpan(void) {}
+
+PointSpan&	PointSpan::operator=(const PointSpan& src)
+{
+	this->_x = src._x;
+	this->_y = src._y;
+	return (*this);
+}
+
+const FixedSpan&	PointSpan::xs(void) const
+{
+	return (this->_x);
+}
+
+const FixedSpan&	PointSpan::ys(void) const
+{
+	return (this->_y);
+}
+
+size_t	PointSpan::size(void) const
+{
+	return (this->_x.size());
+}
+
+PointSpan	PointSpan::subspan(size_t offset, size_t count) const
+{
+	return (PointSpan(this->_x.subspan(offset, count), this->_y.subspan(offset, count)));
+}
+
+Point	PointSpan::get(size_t index) const
+{
+	return (pointFromRaw(this->_x.data()[index], this->_y.data()[index]));
+}
+
+void	PointSpan::set(size_t index, const Point& point)
+{
+	this->_x.set(index, point.getX());
+	this->_y.set(index, point.getY());
+}
+
+
+
+/* PointCloud */
+
+Point	PointCloud::const_iterator::operator*(void) const
+{
+	return (pointFromRaw(*this->_x, *this->_y));
+}
+
+PointCloud::PointCloud(void) {}
+
+PointCloud::PointCloud(size_t size) : _x(size), _y(size) {}
+
+PointCloud::PointCloud(const PointCloud& copy) : _x(copy._x), _y(copy._y) {}
+
+PointCloud::~PointCloud(void) {}
+
+PointCloud&	PointCloud::operator=(const PointCloud& src)
+{
+	if (this != &src)
+	{
+		this->_x = src._x;
+		this->_y = src._y;
+	}
+	return (*this);
+}
+
+size_t	PointCloud::size(void) const
+{
+	return (this->_x.size());
+}
+
+bool	PointCloud::empty(void) const
+{
+	return (this->_x.size() == 0);
+}
+
+void	PointCloud::reserve(size_t capacity)
+{
+	this->_x.reserve(capacity);
+	this->_y.reserve(capacity);
+}
+
+void	PointCloud::resize(size_t size)
+{
+	this->_x.resize(size);
+	this->_y.resize(size);
+}
+
+void	PointCloud::clear(void)
+{
+	this->_x.clear();
+	this->_y.clear();
+}
+
+Point	PointCloud::get(size_t index) const
+{
+	return (pointFromRaw(this->_x.data()[index], this->_y.data()[index]));
+}
+
+void	PointCloud::set(size_t index, const Point& point)
+{
+	this->_x.set(index, point.getX());
+	this->_y.set(index, point.getY());
+}
+
+void	PointCloud::push_back(const Point& point)
+{
+	this->_x.push_back(point.getX());
+	this->_y.push_back(point.getY());
+}
+
+/* Grows geometrically like push_back, so repeated appends stay amortised O(1) */
+static void	growFor(FixedVector& vector, size_t count)
+{
+	const size_t	needed = vector.size() + count;
+
+	if (needed > vector.capacity())
+		vector.reserve(needed > vector.capacity() * 2 ? needed : vector.capacity() * 2);
+	vector.resize(needed);
+}
+
+void	PointCloud::append(const Point* points, size_t count)
+{
+	const size_t	start = this->size();
+
+	growFor(this->_x, count);
+	growFor(this->_y, count);
+
+	int*	x = this->_x.data() + start;
+	int*	y = this->_y.data() + start;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		x[i] = points[i].getX().getRawBits();
+		y[i] = points[i].getY().getRawBits();
+	}
+}
+
+void	PointCloud::appendRaw(const int* x, const int* y, size_t count)
+{
+	const size_t	start = this->size();
+
+	if (count == 0)
+		return ;
+	growFor(this->_x, count);
+	growFor(this->_y, count);
+	std::memcpy(this->_x.data() + start, x, count * sizeof(int));
+	std::memcpy(this->_y.data() + start, y, count * sizeof(int));
+}
+
+/* Same rounding as Fixed(float), through the SIMD FixedSpan::fromFloat */
+void	PointCloud::appendFloat(const float* x, const float* y, size_t count)
+{
+	const size_t	start = this->size();
+
+	growFor(this->_x, count);
+	growFor(this->_y, count);
+	this->_x.span().subspan(start, count).fromFloat(x);
+	this->_y.span().subspan(start, count).fromFloat(y);
+}
+
+PointSpan	PointCloud::view(void)
+{
+	return (PointSpan(this->_x.span(), this->_y.span()));
+}
+
+PointSpan	PointCloud::view(size_t offset, size_t count)
+{
+	return (this->view().subspan(offset, count));
+}
+
+const int*	PointCloud::rawX(void) const
+{
+	return (this->_x.data());
+}
+
+const int*	PointCloud::rawY(void) const
+{
+	return (this->_y.data());
+}
+
+PointCloud::const_iterator	PointCloud::begin(void) const
+{
+	return (const_iterator(this->_x.data(), this->_y.data()));
+}
+
+PointCloud::const_iterator	PointCloud::end(void) const
+{
+	return (const_iterator(this->_x.data() + this->size(), this->_y.data() + this->size()));
+}
@@ -0,0 +1,261 @@
+#include "TriangleGrid.hpp"
+
+#define CELLS_PER_TRIANGLE	2
+#define PREFETCH_CELL		24
+#define PREFETCH_ITEMS		16
+#define PREFETCH_TRIANGLE	8
+
+/* Constructors - Destructors */
+
+TriangleGrid::TriangleGrid(void) : _minX(0), _minY(0), _columns(0), _rows(0), _shift(0) {}
+
+TriangleGrid::TriangleGrid(const TriangleGrid& copy)
+	: _triangles(copy._triangles), _cellStart(copy._cellStart), _items(copy._items),
+	_minX(copy._minX), _minY(copy._minY), _columns(copy._columns), _rows(copy._rows), _shift(copy._shift) {}
+
+TriangleGrid::~TriangleGrid(void) {}
+
+TriangleGrid&	TriangleGrid::operator=(const TriangleGrid& src)
+{
+	if (this != &src)
+	{
+		this->_triangles = src._triangles;
+		this->_cellStart = src._cellStart;
+		this->_items = src._items;
+		this->_minX = src._minX;
+		this->_minY = src._minY;
+		this->_columns = src._columns;
+		this->_rows = src._rows;
+		this->_shift = src._shift;
+	}
+	return (*this);
+}
+
+
+
+/* Build */
+
+void	TriangleGrid::clear(void)
+{
+	this->_triangles.clear();
+	this->_cellStart.clear();
+	this->_items.clear();
+	this->_minX = 0;
+	this->_minY = 0;
+	this->_columns = 0;
+	this->_rows = 0;
+	this->_shift = 0;
+}
+
+void	TriangleGrid::build(const Point* vertices, size_t triangleCount)
+{
+	std::vector<int>	raw(triangleCount * 6);
+
+	this->clear();
+	if (triangleCount == 0)
+		return ;
+
+	// Point hands out Fixed copies: read every coordinate once
+	for (size_t i = 0; i < triangleCount * 3; i++)
+	{
+		raw[i * 2] = vertices[i].getX().getRawBits();
+		raw[i * 2 + 1] = vertices[i].getY().getRawBits();
+	}
+
+	int	minX = raw[0];
+	int	maxX = raw[0];
+	int	minY = raw[1];
+	int	maxY = raw[1];
+
+	for (size_t i = 1; i < triangleCount * 3; i++)
+	{
+		minX = raw[i * 2] < minX ? raw[i * 2] : minX;
+		maxX = raw[i * 2] > maxX ? raw[i * 2] : maxX;
+		minY = raw[i * 2 + 1] < minY ? raw[i * 2 + 1] : minY;
+		maxY = raw[i * 2 + 1] > maxY ? raw[i * 2 + 1] : maxY;
+	}
+
+	// smallest power-of-two cell giving at most CELLS_PER_TRIANGLE cells each
+	const unsigned long long	width = (unsigned long long)((long long)maxX - minX);
+	const unsigned long long	height = (unsigned long long)((long long)maxY - minY);
+	const unsigned long long	budget = (unsigned long long)triangleCount * CELLS_PER_TRIANGLE;
+	int							shift = 0;
+
+	while (((width >> shift) + 1) * ((height >> shift) + 1) > budget && shift < 32)
+		shift++;
+
+	this->_minX = minX;
+	this->_minY = minY;
+	this->_shift = shift;
+	this->_columns = (unsigned int)(width >> shift) + 1;
+	this->_rows = (unsigned int)(height >> shift) + 1;
+	this->_triangles.reserve(triangleCount);
+	for (size_t t = 0; t < triangleCount; t++)
+		this->_triangles.push_back(TriangleQuery(vertices[t * 3], vertices[t * 3 + 1], vertices[t * 3 + 2]));
+
+	// two passes over the bounding boxes: count per cell, then fill
+	std::vector<unsigned int>	box(triangleCount * 4);
+
+	this->_cellStart.assign((size_t)this->_columns * this->_rows + 1, 0);
+	for (size_t t = 0; t < triangleCount; t++)
+	{
+		const int*		v = &raw[t * 6];
+		unsigned int*	b = &box[t * 4];
+		int				lowX = v[0];
+		int				highX = v[0];
+		int				lowY = v[1];
+		int				highY = v[1];
+
+		for (int k = 1; k < 3; k++)
+		{
+			lowX = v[k * 2] < lowX ? v[k * 2] : lowX;
+			highX = v[k * 2] > highX ? v[k * 2] : highX;
+			lowY = v[k * 2 + 1] < lowY ? v[k * 2 + 1] : lowY;
+			highY = v[k * 2 + 1] > highY ? v[k * 2 + 1] : highY;
+		}
+		b[0] = (unsigned int)(((long long)lowX - minX) >> shift);
+		b[1] = (unsigned int)(((long long)highX - minX) >> shift);
+		b[2] = (unsigned int)(((long long)lowY - minY) >> shift);
+		b[3] = (unsigned int)(((long long)highY - minY) >> shift);
+		if (this->_triangles[t].degenerate())
+			continue ;
+		for (unsigned int row = b[2]; row <= b[3]; row++)
+			for (unsigned int column = b[0]; column <= b[1]; column++)
+				this->_cellStart[(size_t)row * this->_columns + column + 1]++;
+	}
+	for (size_t c = 1; c < this->_cellStart.size(); c++)
+		this->_cellStart[c] += this->_cellStart[c - 1];
+
+	std::vector<unsigned int>	fill(this->_cellStart.begin(), this->_cellStart.end() - 1);
+
+	this->_items.resize(this->_cellStart.back());
+	for (size_t t = 0; t < triangleCount; t++)
+	{
+		const unsigned int*	b = &box[t * 4];
+
+		if (this->_triangles[t].degenerate())
+			continue ;
+		for (unsigned int row = b[2]; row <= b[3]; row++)
+			for (unsigned int column = b[0]; column <= b[1]; column++)
+				this->_items[fill[(size_t)row * this->_columns + column]++] = (unsigned int)t;
+	}
+}
+
+
+
+/* Accessors */
+
+size_t	TriangleGrid::size(void) const
+{
+	return (this->_triangles.size());
+}
+
+size_t	TriangleGrid::cellCount(void) const
+{
+	return ((size_t)this->_columns * this->_rows);
+}
+
+size_t	TriangleGrid::itemCount(void) const
+{
+	return (this->_items.size());
+}
+
+
+
+/* Queries */
+
+bool	TriangleGrid::_cellOf(int x, int y, size_t& cell) const
+{
+	const unsigned long long	column = (unsigned long long)((long long)x - this->_minX) >> this->_shift;
+	const unsigned long long	row = (unsigned long long)((long long)y - this->_minY) >> this->_shift;
+
+	// left of / below the grid wraps to huge values: one compare per axis
+	if (column >= this->_columns || row >= this->_rows)
+		return (false);
+	cell = (size_t)row * this->_columns + column;
+	return (true);
+}
+
+long	TriangleGrid::findRaw(int x, int y) const
+{
+	size_t	cell;
+
+	if (!this->_cellOf(x, y, cell))
+		return (-1);
+	for (unsigned int i = this->_cellStart[cell]; i < this->_cellStart[cell + 1]; i++)
+		if (this->_triangles[this->_items[i]].containsRaw(x, y))
+			return (this->_items[i]);
+	return (-1);
+}
+
+long	TriangleGrid::find(const Point& point) const
+{
+	return (this->findRaw(point.getX().getRawBits(), point.getY().getRawBits()));
+}
+
+size_t	TriangleGrid::findAll(const Point& point, std::vector<size_t>& out) const
+{
+	const int	x = point.getX().getRawBits();
+	const int	y = point.getY().getRawBits();
+	size_t		cell;
+	size_t		found = 0;
+
+	if (!this->_cellOf(x, y, cell))
+		return (0);
+	for (unsigned int i = this->_cellStart[cell]; i < this->_cellStart[cell + 1]; i++)
+	{
+		if (this->_triangles[this->_items[i]].containsRaw(x, y))
+		{
+			out.push_back(this->_items[i]);
+			found++;
+		}
+	}
+	return (found);
+}
+
+/*
+ * Random points hit random cells, and on a large mesh each query then
+ * misses the cache three times in a row (cell range, item list, triangle).
+ * The bulk query runs a prefetch pipeline ahead of the current point:
+ * PREFETCH_CELL points ahead it fetches the cell range, PREFETCH_ITEMS
+ * ahead (the range is in cache by then) the item list, PREFETCH_TRIANGLE
+ * ahead the first candidate triangles, so the misses overlap.
+ */
+size_t	TriangleGrid::find(const FixedSpan& xs, const FixedSpan& ys, long* triangle) const
+{
+	const size_t	n = xs.size() < ys.size() ? xs.size() : ys.size();
+	const int*		px = xs.data();
+	const int*		py = ys.data();
+	size_t			found = 0;
+	size_t			cell;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		if (i + PREFETCH_CELL < n && this->_cellOf(px[i + PREFETCH_CELL], py[i + PREFETCH_CELL], cell))
+			__builtin_prefetch(&this->_cellStart[cell]);
+		if (i + PREFETCH_ITEMS < n && this->_cellOf(px[i + PREFETCH_ITEMS], py[i + PREFETCH_ITEMS], cell))
+		{
+			const unsigned int	start = this->_cellStart[cell];
+
+			// an empty cell may start at _items.size(), or _items be empty
+			if (start < this->_items.size())
+				__builtin_prefetch(&this->_items[start]);
+		}
+		if (i + PREFETCH_TRIANGLE < n && this->_cellOf(px[i + PREFETCH_TRIANGLE], py[i + PREFETCH_TRIANGLE], cell))
+		{
+			const unsigned int	first = this->_cellStart[cell];
+			const unsigned int	last = this->_cellStart[cell + 1];
+
+			for (unsigned int item = first; item < last && item < first + 4; item++)
+				__builtin_prefetch(&this->_triangles[this->_items[item]]);
+		}
+		triangle[i] = this->findRaw(px[i], py[i]);
+		found += (triangle[i] >= 0);
+	}
+	return (found);
+}
+
+size_t	TriangleGrid::find(const PointSpan& points, long* triangle) const
+{
+	return (this->find(points.xs(), points.ys(), triangle));
+}
@@ -0,0 +1,227 @@
+#include <cstring>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#endif
+
+#include "TriangleQuery.hpp"
+
+/* Constructors - Destructors */
+
+TriangleQuery::TriangleQuery(void) : _minX(0), _maxX(0), _minY(0), _maxY(0), _degenerate(true), _wide(false)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		this->_x[i] = 0;
+		this->_y[i] = 0;
+	}
+}
+
+TriangleQuery::TriangleQuery(const Point& a, const Point& b, const Point& c)
+{
+	const Point*	vertices[3] = {&a, &b, &c};
+
+	for (int i = 0; i < 3; i++)
+	{
+		this->_x[i] = vertices[i]->getX().getRawBits();
+		this->_y[i] = vertices[i]->getY().getRawBits();
+	}
+
+	// twice the signed area, exact: differences need 33 bits, products 66
+	const __int128	area = (__int128)((long long)this->_x[1] - this->_x[0]) * ((long long)this->_y[2] - this->_y[0])
+		- (__int128)((long long)this->_y[1] - this->_y[0]) * ((long long)this->_x[2] - this->_x[0]);
+
+	this->_degenerate = (area == 0);
+	if (area < 0)
+	{
+		int	swap;
+
+		swap = this->_x[1];
+		this->_x[1] = this->_x[2];
+		this->_x[2] = swap;
+		swap = this->_y[1];
+		this->_y[1] = this->_y[2];
+		this->_y[2] = swap;
+	}
+
+	this->_minX = this->_x[0];
+	this->_maxX = this->_x[0];
+	this->_minY = this->_y[0];
+	this->_maxY = this->_y[0];
+	for (int i = 1; i < 3; i++)
+	{
+		this->_minX = this->_x[i] < this->_minX ? this->_x[i] : this->_minX;
+		this->_maxX = this->_x[i] > this->_maxX ? this->_x[i] : this->_maxX;
+		this->_minY = this->_y[i] < this->_minY ? this->_y[i] : this->_minY;
+		this->_maxY = this->_y[i] > this->_maxY ? this->_y[i] : this->_maxY;
+	}
+	this->_wide = ((long long)this->_maxX - this->_minX >= (1LL << 31)
+		|| (long long)this->_maxY - this->_minY >= (1LL << 31));
+}
+
+TriangleQuery::TriangleQuery(const TriangleQuery& copy)
+{
+	*this = copy;
+}
+
+TriangleQuery::~TriangleQuery(void) {}
+
+TriangleQuery&	TriangleQuery::operator=(const TriangleQuery& src)
+{
+	if (this != &src)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			this->_x[i] = src._x[i];
+			this->_y[i] = src._y[i];
+		}
+		this->_minX = src._minX;
+		this->_maxX = src._maxX;
+		this->_minY = src._minY;
+		this->_maxY = src._maxY;
+		this->_degenerate = src._degenerate;
+		this->_wide = src._wide;
+	}
+	return (*this);
+}
+
+
+
+/* Queries */
+
+bool	TriangleQuery::degenerate(void) const
+{
+	return (this->_degenerate);
+}
+
+bool	TriangleQuery::contains(const Point& point) const
+{
+	return (this->containsRaw(point.getX().getRawBits(), point.getY().getRawBits()));
+}
+
+/* 32-bit wrapping difference: exact while both ends are in a narrow box */
+static inline long long	narrowDiff(int a, int b)
+{
+	return ((int)((unsigned int)a - (unsigned int)b));
+}
+
+bool	TriangleQuery::containsRaw(int x, int y) const
+{
+	if (this->_degenerate)
+		return (false);
+	if (this->_wide)
+		return (x > this->_minX && x < this->_maxX && y > this->_minY && y < this->_maxY
+			&& this->_containsWide(x, y));
+
+	// inside or not is unpredictable: combine all seven tests without branching
+	bool	inside = (x > this->_minX) & (x < this->_maxX) & (y > this->_minY) & (y < this->_maxY);
+
+	for (int i = 0; i < 3; i++)
+	{
+		const int		next = i == 2 ? 0 : i + 1;
+		const long long	edge = narrowDiff(this->_x[next], this->_x[i]) * narrowDiff(y, this->_y[i])
+			- narrowDiff(this->_y[next], this->_y[i]) * narrowDiff(x, this->_x[i]);
+
+		inside &= (edge > 0);
+	}
+	return (inside);
+}
+
+bool	TriangleQuery::_containsWide(int x, int y) const
+{
+	for (int i = 0; i < 3; i++)
+	{
+		const int		next = i == 2 ? 0 : i + 1;
+		const __int128	edge = (__int128)((long long)this->_x[next] - this->_x[i]) * ((long long)y - this->_y[i])
+			- (__int128)((long long)this->_y[next] - this->_y[i]) * ((long long)x - this->_x[i]);
+
+		if (edge <= 0)
+			return (false);
+	}
+	return (true);
+}
+
+#if defined(__AVX2__)
+/* Lane mask of E(p) > 0 for one edge, 8 points */
+static inline __m256i	edgeLanes(__m256i px, __m256i py, int ox, int oy, int ex, int ey)
+{
+	const __m256i	dx = _mm256_sub_epi32(px, _mm256_set1_epi32(ox));
+	const __m256i	dy = _mm256_sub_epi32(py, _mm256_set1_epi32(oy));
+	const __m256i	vex = _mm256_set1_epi32(ex);
+	const __m256i	vey = _mm256_set1_epi32(ey);
+	const __m256i	zero = _mm256_setzero_si256();
+
+	// _mm256_mul_epi32 widens the even lanes: the odd ones are shifted down first
+	__m256i	even = _mm256_sub_epi64(_mm256_mul_epi32(vex, dy), _mm256_mul_epi32(vey, dx));
+	__m256i	odd = _mm256_sub_epi64(_mm256_mul_epi32(vex, _mm256_srli_epi64(dy, 32)),
+		_mm256_mul_epi32(vey, _mm256_srli_epi64(dx, 32)));
+
+	return (_mm256_blend_epi32(_mm256_cmpgt_epi64(even, zero), _mm256_cmpgt_epi64(odd, zero), 0xAA));
+}
+#endif
+
+size_t	TriangleQuery::classify(const FixedSpan& xs, const FixedSpan& ys, unsigned char* inside) const
+{
+	const size_t	n = xs.size() < ys.size() ? xs.size() : ys.size();
+	const int*		px = xs.data();
+	const int*		py = ys.data();
+	size_t			count = 0;
+	size_t			i = 0;
+
+	if (this->_degenerate)
+	{
+		if (n != 0)
+			std::memset(inside, 0, n);
+		return (0);
+	}
+#if defined(__AVX2__)
+	if (!this->_wide)
+	{
+		const __m256i	minX = _mm256_set1_epi32(this->_minX);
+		const __m256i	maxX = _mm256_set1_epi32(this->_maxX);
+		const __m256i	minY = _mm256_set1_epi32(this->_minY);
+		const __m256i	maxY = _mm256_set1_epi32(this->_maxY);
+		const int		ex[3] = {this->_x[1] - this->_x[0], this->_x[2] - this->_x[1], this->_x[0] - this->_x[2]};
+		const int		ey[3] = {this->_y[1] - this->_y[0], this->_y[2] - this->_y[1], this->_y[0] - this->_y[2]};
+
+		for (; i + 8 <= n; i += 8)
+		{
+			const __m256i	x = _mm256_loadu_si256((const __m256i*)(px + i));
+			const __m256i	y = _mm256_loadu_si256((const __m256i*)(py + i));
+			__m256i			mask = _mm256_and_si256(
+				_mm256_and_si256(_mm256_cmpgt_epi32(x, minX), _mm256_cmpgt_epi32(maxX, x)),
+				_mm256_and_si256(_mm256_cmpgt_epi32(y, minY), _mm256_cmpgt_epi32(maxY, y)));
+			unsigned long long	bytes = 0;
+
+			// most points of a large set miss a small triangle's box: skip the products
+			if (!_mm256_testz_si256(mask, mask))
+			{
+				for (int e = 0; e < 3; e++)
+					mask = _mm256_and_si256(mask, edgeLanes(x, y, this->_x[e], this->_y[e], ex[e], ey[e]));
+
+				const unsigned int	bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+
+				// 0 / -1 lanes -> 0 / 1 bytes, in order
+				const __m256i	words = _mm256_packs_epi32(mask, mask);
+				const __m256i	packed = _mm256_packs_epi16(words, words);
+
+				bytes = ((unsigned long long)(unsigned int)_mm_cvtsi128_si32(_mm256_extracti128_si256(packed, 1)) << 32)
+					| (unsigned int)_mm_cvtsi128_si32(_mm256_castsi256_si128(packed));
+				bytes &= 0x0101010101010101ULL;
+				count += __builtin_popcount(bits);
+			}
+			std::memcpy(inside + i, &bytes, 8);
+		}
+	}
+#endif
+	for (; i < n; i++)
+	{
+		inside[i] = this->containsRaw(px[i], py[i]);
+		count += inside[i];
+	}
+	return (count);
+}
+
+size_t	TriangleQuery::classify(const PointSpan& points, unsigned char* inside) const
+{
+	return (this->classify(points.xs(), points.ys(), inside));
+}
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <ctime>
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+#include "Bench.hpp"
+
+struct	BenchRecord
+{
+	std::string	section;
+	std::string	name;
+	double		nsPerOp;
+	double		cyclesPerOp;
+};
+
+/* Function-local so that it exists before any section runs */
+static std::vector<BenchRecord>&	records(void)
+{
+	static std::vector<BenchRecord>	all;
+
+	return (all);
+}
+
+static std::string&	currentSection(void)
+{
+	static std::string	name;
+
+	return (name);
+}
+
+uint64_t	Bench::nowNs(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+/*
+ * Time stamp counter ticks per ns, measured once over ~20 ms. The TSC runs
+ * at the nominal frequency whatever the core does, so cycles/op are
+ * reference cycles: comparable between runs on one machine, not between
+ * machines. 0 where there is no TSC.
+ */
+double	Bench::cyclesPerNs(void)
+{
+	static double	ratio = -1.0;
+
+	if (ratio >= 0.0)
+		return (ratio);
+#if defined(__x86_64__) || defined(__i386__)
+	const uint64_t	startNs = nowNs();
+	const uint64_t	startTicks = __rdtsc();
+	uint64_t		ns;
+
+	do
+		ns = nowNs() - startNs;
+	while (ns < 20000000);
+	ratio = (double)(__rdtsc() - startTicks) / ns;
+#else
+	ratio = 0.0;
+#endif
+	return (ratio);
+}
+
+void	Bench::section(const char* name)
+{
+	currentSection() = name;
+	std::cout << std::endl << "== " << name << " ==" << std::endl;
+}
+
+void	Bench::report(const char* name, uint64_t ns, size_t ops)
+{
+	double		perOp = ops ? (double)ns / ops : 0.0;
+	BenchRecord	record;
+
+	record.section = currentSection();
+	record.name = name;
+	record.nsPerOp = perOp;
+	record.cyclesPerOp = perOp * cyclesPerNs();
+	records().push_back(record);
+
+	std::cout << "  " << std::left << std::setw(34) << name << std::right
+		<< std::fixed << std::setprecision(3) << std::setw(10) << perOp << " ns/op"
+		<< std::setprecision(1) << std::setw(10) << record.cyclesPerOp << " cyc/op"
+		<< std::setprecision(3) << std::setw(12) << (perOp > 0 ? 1000.0 / perOp : 0.0) << " Mop/s" << std::endl;
+}
+
+static std::string	jsonString(const std::string& text)
+{
+	std::string	quoted = "\"";
+
+	for (size_t i = 0; i < text.size(); i++)
+	{
+		if (text[i] == '"' || text[i] == '\\')
+			quoted += '\\';
+		quoted += text[i];
+	}
+	return (quoted + "\"");
+}
+
+bool	Bench::writeJson(const char* path)
+{
+	std::ofstream						out(path);
+	const std::vector<BenchRecord>&		all = records();
+
+	if (!out)
+		return (false);
+	out << "{\n  \"bench\": \"fixedBench\",\n  \"cycles_per_ns\": "
+		<< std::fixed << std::setprecision(4) << cyclesPerNs() << ",\n  \"results\": [";
+	for (size_t i = 0; i < all.size(); i++)
+	{
+		out << (i ? "," : "") << "\n    {\"section\": " << jsonString(all[i].section)
+			<< ", \"name\": " << jsonString(all[i].name)
+			<< ", \"ns_per_op\": " << std::setprecision(4) << all[i].nsPerOp
+			<< ", \"cycles_per_op\": " << std::setprecision(2) << all[i].cyclesPerOp
+			<< ", \"mops\": " << std::setprecision(3) << (all[i].nsPerOp > 0 ? 1000.0 / all[i].nsPerOp : 0.0) << "}";
+	}
+	out << "\n  ]\n}\n";
+	return (out.good());
+}
@@ -0,0 +1,58 @@
+#include <vector>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "FixedSpan.hpp"
+
+#define CONVERT_SIZE	4096
+#define CONVERT_REPEAT	2048
+
+void	benchConvert(void)
+{
+	std::vector<float>	input(CONVERT_SIZE);
+	std::vector<float>	output(CONVERT_SIZE);
+	FixedVector			fixed(CONVERT_SIZE);
+	FixedSpan			span = fixed.span();
+	const size_t		ops = (size_t)CONVERT_SIZE * CONVERT_REPEAT;
+	uint64_t			start;
+
+	srand(5);
+	for (size_t i = 0; i < CONVERT_SIZE; i++)
+		input[i] = (rand() % 2000000 - 1000000) / 97.0f;
+
+	Bench::section("float <-> Fixed conversion (4096 elements)");
+
+	start = Bench::nowNs();
+	for (int r = 0; r < CONVERT_REPEAT; r++)
+	{
+		for (size_t i = 0; i < CONVERT_SIZE; i++)
+			fixed.set(i, Fixed(input[i]));
+		Bench::clobber();
+	}
+	Bench::report("Fixed(float) one at a time", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < CONVERT_REPEAT; r++)
+	{
+		span.fromFloat(&input[0]);
+		Bench::clobber();
+	}
+	Bench::report("FixedSpan::fromFloat", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < CONVERT_REPEAT; r++)
+	{
+		for (size_t i = 0; i < CONVERT_SIZE; i++)
+			output[i] = fixed.get(i).toFloat();
+		Bench::clobber();
+	}
+	Bench::report("Fixed::toFloat one at a time", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < CONVERT_REPEAT; r++)
+	{
+		span.toFloat(&output[0]);
+		Bench::clobber();
+	}
+	Bench::report("FixedSpan::toFloat", Bench::nowNs() - start, ops);
+}
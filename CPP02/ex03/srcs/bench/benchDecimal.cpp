@@ -0,0 +1,64 @@
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "FixedDecimal.hpp"
+
+#define DECIMAL_SIZE	4096
+#define DECIMAL_REPEAT	64
+
+void	benchDecimal(void)
+{
+	std::vector<Fixed>	values(DECIMAL_SIZE);
+	std::vector<char>	text(DECIMAL_SIZE * FixedDecimal::BUFFER_SIZE);
+	const size_t		ops = (size_t)DECIMAL_SIZE * DECIMAL_REPEAT;
+	std::ostringstream	stream;
+	uint64_t			start;
+
+	srand(7);
+	for (size_t i = 0; i < DECIMAL_SIZE; i++)
+		values[i].setRawBits(rand() % 200000000 - 100000000);
+
+	Bench::section("decimal text <-> Fixed (4096 values)");
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DECIMAL_REPEAT; r++)
+		for (size_t i = 0; i < DECIMAL_SIZE; i++)
+		{
+			stream.str("");
+			stream << values[i].toFloat();
+			Bench::keep(stream.tellp());
+		}
+	Bench::report("ostream << toFloat()", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DECIMAL_REPEAT; r++)
+	{
+		for (size_t i = 0; i < DECIMAL_SIZE; i++)
+			FixedDecimal::format(values[i], &text[i * FixedDecimal::BUFFER_SIZE], FixedDecimal::BUFFER_SIZE);
+		Bench::clobber();
+	}
+	Bench::report("FixedDecimal::format", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DECIMAL_REPEAT; r++)
+		for (size_t i = 0; i < DECIMAL_SIZE; i++)
+		{
+			Fixed	value(strtof(&text[i * FixedDecimal::BUFFER_SIZE], NULL));
+
+			Bench::keep(value);
+		}
+	Bench::report("Fixed(strtof(str))", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DECIMAL_REPEAT; r++)
+		for (size_t i = 0; i < DECIMAL_SIZE; i++)
+		{
+			Fixed	value;
+
+			FixedDecimal::parse(&text[i * FixedDecimal::BUFFER_SIZE], value);
+			Bench::keep(value);
+		}
+	Bench::report("FixedDecimal::parse", Bench::nowNs() - start, ops);
+}
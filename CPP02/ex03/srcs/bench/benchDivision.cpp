@@ -0,0 +1,79 @@
+#include <iostream>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "FixedDivisor.hpp"
+
+#define DIVISION_SIZE	4096
+#define DIVISION_REPEAT	1024
+
+static void __attribute__((noinline))	divideLoop(int* __restrict out, const int* __restrict in,
+	int divisor, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		out[i] = (int)(((long long)in[i] << 8) / divisor);
+}
+
+void	benchDivision(void)
+{
+	FixedVector		input(DIVISION_SIZE);
+	FixedVector		output(DIVISION_SIZE);
+	Fixed			divisor(3.14159f);
+	FixedDivisor	reciprocal(divisor);
+	const size_t	ops = (size_t)DIVISION_SIZE * DIVISION_REPEAT;
+	uint64_t		start;
+
+	srand(4);
+	for (size_t i = 0; i < DIVISION_SIZE; i++)
+		input.data()[i] = rand() % 2000000 - 1000000;
+
+	Bench::section("division by a repeated divisor");
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DIVISION_REPEAT; r++)
+	{
+		Fixed	q;
+
+		for (size_t i = 0; i < DIVISION_SIZE; i++)
+			q = input.get(i) / divisor;
+		Bench::keep(q);
+	}
+	Bench::report("Fixed::operator/", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DIVISION_REPEAT; r++)
+	{
+		divideLoop(output.data(), input.data(), divisor.getRawBits(), DIVISION_SIZE);
+		Bench::clobber();
+	}
+	Bench::report("raw 64-bit idiv loop", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DIVISION_REPEAT; r++)
+	{
+		Fixed	q;
+
+		for (size_t i = 0; i < DIVISION_SIZE; i++)
+			q = reciprocal.divide(input.get(i));
+		Bench::keep(q);
+	}
+	Bench::report("FixedDivisor::divide (scalar)", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DIVISION_REPEAT; r++)
+	{
+		output = input;
+		reciprocal.divide(output.span());
+		Bench::clobber();
+	}
+	Bench::report("FixedDivisor::divide (array)", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < DIVISION_REPEAT; r++)
+	{
+		FixedDivisor	setup(Fixed(r + 1));
+
+		Bench::keep(setup);
+	}
+	Bench::report("FixedDivisor setup", Bench::nowNs() - start, DIVISION_REPEAT);
+}
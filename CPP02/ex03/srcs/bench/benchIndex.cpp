@@ -0,0 +1,105 @@
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "TriangleGrid.hpp"
+
+#define INDEX_POINTS		(1 << 20)
+#define INDEX_BRUTE_POINTS	(1 << 14)
+#define INDEX_EXTENT		1000.0f
+
+static float	jitter(float amount)
+{
+	return (amount * ((rand() % 2001 - 1000) / 1000.0f));
+}
+
+/* side x side squares over [-INDEX_EXTENT, INDEX_EXTENT], 2 triangles each */
+static void	makeMesh(int side, std::vector<Point>& mesh)
+{
+	const float			step = 2 * INDEX_EXTENT / side;
+	std::vector<float>	gx((side + 1) * (side + 1));
+	std::vector<float>	gy((side + 1) * (side + 1));
+
+	for (int row = 0; row <= side; row++)
+		for (int column = 0; column <= side; column++)
+		{
+			const bool	border = (row == 0 || column == 0 || row == side || column == side);
+			const int	v = row * (side + 1) + column;
+
+			gx[v] = -INDEX_EXTENT + column * step + (border ? 0 : jitter(step / 4));
+			gy[v] = -INDEX_EXTENT + row * step + (border ? 0 : jitter(step / 4));
+		}
+	mesh.clear();
+	mesh.reserve((size_t)side * side * 6);
+	for (int row = 0; row < side; row++)
+		for (int column = 0; column < side; column++)
+		{
+			const int	v = row * (side + 1) + column;
+			const int	corner[4] = {v, v + 1, v + side + 2, v + side + 1};
+
+			mesh.push_back(Point(gx[corner[0]], gy[corner[0]]));
+			mesh.push_back(Point(gx[corner[1]], gy[corner[1]]));
+			mesh.push_back(Point(gx[corner[2]], gy[corner[2]]));
+			mesh.push_back(Point(gx[corner[0]], gy[corner[0]]));
+			mesh.push_back(Point(gx[corner[2]], gy[corner[2]]));
+			mesh.push_back(Point(gx[corner[3]], gy[corner[3]]));
+		}
+}
+
+static std::string	label(const char* what, size_t triangles)
+{
+	std::ostringstream	name;
+
+	name << what << " (" << triangles << " tris)";
+	return (name.str());
+}
+
+void	benchIndex(void)
+{
+	static const int	sides[] = {23, 71, 159, 317};
+	std::vector<Point>	mesh;
+	PointCloud			cloud;
+	std::vector<long>	found(INDEX_POINTS);
+	uint64_t			start;
+
+	srand(9);
+	cloud.reserve(INDEX_POINTS);
+	for (size_t i = 0; i < INDEX_POINTS; i++)
+		cloud.push_back(Point(jitter(INDEX_EXTENT), jitter(INDEX_EXTENT)));
+
+	Bench::section("TriangleGrid: build ns/triangle, query ns/point (1M points)");
+	for (size_t s = 0; s < sizeof(sides) / sizeof(sides[0]); s++)
+	{
+		TriangleGrid	grid;
+		size_t			count = (size_t)sides[s] * sides[s] * 2;
+
+		makeMesh(sides[s], mesh);
+		start = Bench::nowNs();
+		grid.build(&mesh[0], count);
+		Bench::report(label("build", count).c_str(), Bench::nowNs() - start, count);
+
+		start = Bench::nowNs();
+		size_t	hits = grid.find(cloud.view(), &found[0]);
+
+		Bench::report(label("find", count).c_str(), Bench::nowNs() - start, INDEX_POINTS);
+		Bench::keep(hits);
+
+		if (s != 0)
+			continue ;
+		// reference: every triangle against every point, with the SIMD classifier
+		std::vector<unsigned char>	inside(INDEX_BRUTE_POINTS);
+		PointSpan					brute = cloud.view(0, INDEX_BRUTE_POINTS);
+
+		start = Bench::nowNs();
+		for (size_t t = 0; t < count; t++)
+		{
+			size_t	inTriangle = TriangleQuery(mesh[t * 3], mesh[t * 3 + 1], mesh[t * 3 + 2])
+				.classify(brute, &inside[0]);
+
+			Bench::keep(inTriangle);
+		}
+		Bench::report(label("brute force classify", count).c_str(), Bench::nowNs() - start, INDEX_BRUTE_POINTS);
+	}
+}
@@ -0,0 +1,182 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "FixedSpan.hpp"
+
+#define KERNEL_SIZE		4096
+#define KERNEL_REPEAT	4096
+
+template <typename T>
+static void __attribute__((noinline))	addLoop(T* __restrict a, const T* __restrict b, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		a[i] += b[i];
+}
+
+template <typename T>
+static void __attribute__((noinline))	mulLoop(T* __restrict a, const T* __restrict b, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		a[i] *= b[i];
+}
+
+template <typename T>
+static void __attribute__((noinline))	scaleLoop(T* __restrict a, T factor, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		a[i] *= factor;
+}
+
+template <typename T>
+static T __attribute__((noinline))	dotLoop(const T* __restrict a, const T* __restrict b, size_t n)
+{
+	T	sum = 0;
+
+	for (size_t i = 0; i < n; i++)
+		sum += a[i] * b[i];
+	return (sum);
+}
+
+/*
+ * Every kernel restarts from the same inputs. mul uses a multiplier of 1:
+ * thousands of chained products of random values end up in float denormals,
+ * which would measure the FPU's slow path instead of the loop.
+ */
+static void	fill(FixedVector& fixed, std::vector<float>& f, std::vector<double>& d, unsigned int seed)
+{
+	srand(seed);
+	for (size_t i = 0; i < KERNEL_SIZE; i++)
+	{
+		float	value = seed ? 0.75f + (rand() % 128) / 256.0f : 1.0f;
+
+		fixed.set(i, Fixed(value));
+		f[i] = value;
+		d[i] = value;
+	}
+}
+
+template <typename T>
+static void	runFloating(const char* type, const std::vector<T>& input,
+	const std::vector<T>& b, const std::vector<T>& unit)
+{
+	std::vector<T>	a(input);
+	const size_t	ops = (size_t)KERNEL_SIZE * KERNEL_REPEAT;
+	std::string		name;
+	uint64_t		start;
+
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		addLoop(&a[0], &b[0], KERNEL_SIZE);
+		Bench::clobber();
+	}
+	Bench::report((name = std::string(type) + " add").c_str(), Bench::nowNs() - start, ops);
+
+	a = input;
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		mulLoop(&a[0], &unit[0], KERNEL_SIZE);
+		Bench::clobber();
+	}
+	Bench::report((name = std::string(type) + " mul").c_str(), Bench::nowNs() - start, ops);
+
+	a = input;
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		scaleLoop(&a[0], (T)0.999, KERNEL_SIZE);
+		Bench::clobber();
+	}
+	Bench::report((name = std::string(type) + " scale").c_str(), Bench::nowNs() - start, ops);
+
+	a = input;
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		T	sum = dotLoop(&a[0], &b[0], KERNEL_SIZE);
+
+		Bench::keep(sum);
+	}
+	Bench::report((name = std::string(type) + " dot").c_str(), Bench::nowNs() - start, ops);
+}
+
+void	benchKernels(void)
+{
+	FixedVector			fa(KERNEL_SIZE);
+	FixedVector			fb(KERNEL_SIZE);
+	FixedVector			fu(KERNEL_SIZE);
+	std::vector<float>	floatA(KERNEL_SIZE), floatB(KERNEL_SIZE), floatU(KERNEL_SIZE);
+	std::vector<double>	doubleA(KERNEL_SIZE), doubleB(KERNEL_SIZE), doubleU(KERNEL_SIZE);
+	const size_t		ops = (size_t)KERNEL_SIZE * KERNEL_REPEAT;
+	uint64_t			start;
+
+	fill(fa, floatA, doubleA, 1);
+	fill(fb, floatB, doubleB, 2);
+	fill(fu, floatU, doubleU, 0);
+
+	Bench::section("FixedSpan kernels vs float/double arrays (4096 elements)");
+#if defined(__AVX2__)
+	std::cout << "  path: AVX2" << std::endl;
+#elif defined(__SSE4_1__)
+	std::cout << "  path: SSE4.1" << std::endl;
+#else
+	std::cout << "  path: scalar (SSE2 for add/sub)" << std::endl;
+#endif
+
+	FixedSpan	a = fa.span();
+	FixedSpan	b = fb.span();
+
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		a.add(b);
+		Bench::clobber();
+	}
+	Bench::report("FixedSpan add", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		Fixed	sum;
+
+		for (size_t i = 0; i < KERNEL_SIZE; i++)
+			sum = fa.get(i) + fb.get(i);
+		Bench::keep(sum);
+	}
+	Bench::report("Fixed::operator+ (one at a time)", Bench::nowNs() - start, ops);
+
+	fill(fa, floatA, doubleA, 1);
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		a.mul(fu.span());
+		Bench::clobber();
+	}
+	Bench::report("FixedSpan mul", Bench::nowNs() - start, ops);
+
+	fill(fa, floatA, doubleA, 1);
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		a.scale(Fixed(0.999f));
+		Bench::clobber();
+	}
+	Bench::report("FixedSpan scale", Bench::nowNs() - start, ops);
+
+	fill(fa, floatA, doubleA, 1);
+	start = Bench::nowNs();
+	for (int r = 0; r < KERNEL_REPEAT; r++)
+	{
+		long long	sum = a.dotRaw(b);
+
+		Bench::keep(sum);
+	}
+	Bench::report("FixedSpan dot", Bench::nowNs() - start, ops);
+
+	runFloating("float", floatA, floatB, floatU);
+	runFloating("double", doubleA, doubleB, doubleU);
+}
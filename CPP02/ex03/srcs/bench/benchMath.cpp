@@ -0,0 +1,95 @@
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "FixedMath.hpp"
+
+#define MATH_SIZE	4096
+#define MATH_REPEAT	64
+
+typedef Fixed	(*UnaryFixed)(const Fixed&);
+typedef float	(*UnaryFloat)(float);
+
+static float	reciprocalf(float x)
+{
+	return (1.0f / x);
+}
+
+static void	runUnary(const char* fixedName, UnaryFixed fixedFn, const char* floatName, UnaryFloat floatFn,
+	float low, float high)
+{
+	std::vector<Fixed>	fixedIn(MATH_SIZE);
+	std::vector<float>	floatIn(MATH_SIZE);
+	const size_t		ops = (size_t)MATH_SIZE * MATH_REPEAT;
+	uint64_t			start;
+
+	for (size_t i = 0; i < MATH_SIZE; i++)
+	{
+		floatIn[i] = low + (high - low) * (rand() % 10000) / 10000.0f;
+		fixedIn[i] = Fixed(floatIn[i]);
+	}
+
+	start = Bench::nowNs();
+	for (int r = 0; r < MATH_REPEAT; r++)
+		for (size_t i = 0; i < MATH_SIZE; i++)
+		{
+			Fixed	value = fixedFn(fixedIn[i]);
+
+			Bench::keep(value);
+		}
+	Bench::report(fixedName, Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < MATH_REPEAT; r++)
+		for (size_t i = 0; i < MATH_SIZE; i++)
+		{
+			float	value = floatFn(floatIn[i]);
+
+			Bench::keep(value);
+		}
+	Bench::report(floatName, Bench::nowNs() - start, ops);
+}
+
+void	benchMath(void)
+{
+	srand(6);
+	Bench::section("FixedMath vs libm on float");
+	runUnary("FixedMath::sqrt", &FixedMath::sqrt, "sqrtf", &sqrtf, 0.0f, 10000.0f);
+	runUnary("FixedMath::reciprocal", &FixedMath::reciprocal, "1.0f / x", &reciprocalf, 0.5f, 1000.0f);
+	runUnary("FixedMath::sin", &FixedMath::sin, "sinf", &sinf, -100.0f, 100.0f);
+	runUnary("FixedMath::cos", &FixedMath::cos, "cosf", &cosf, -100.0f, 100.0f);
+	runUnary("FixedMath::exp", &FixedMath::exp, "expf", &expf, -6.0f, 15.0f);
+	runUnary("FixedMath::log", &FixedMath::log, "logf", &logf, 0.01f, 100000.0f);
+
+	std::vector<Fixed>	fy(MATH_SIZE), fx(MATH_SIZE);
+	std::vector<float>	y(MATH_SIZE), x(MATH_SIZE);
+	const size_t		ops = (size_t)MATH_SIZE * MATH_REPEAT;
+	uint64_t			start;
+
+	for (size_t i = 0; i < MATH_SIZE; i++)
+	{
+		y[i] = (rand() % 20000 - 10000) / 100.0f;
+		x[i] = (rand() % 20000 - 10000) / 100.0f;
+		fy[i] = Fixed(y[i]);
+		fx[i] = Fixed(x[i]);
+	}
+	start = Bench::nowNs();
+	for (int r = 0; r < MATH_REPEAT; r++)
+		for (size_t i = 0; i < MATH_SIZE; i++)
+		{
+			Fixed	value = FixedMath::atan2(fy[i], fx[i]);
+
+			Bench::keep(value);
+		}
+	Bench::report("FixedMath::atan2", Bench::nowNs() - start, ops);
+	start = Bench::nowNs();
+	for (int r = 0; r < MATH_REPEAT; r++)
+		for (size_t i = 0; i < MATH_SIZE; i++)
+		{
+			float	value = atan2f(y[i], x[i]);
+
+			Bench::keep(value);
+		}
+	Bench::report("atan2f", Bench::nowNs() - start, ops);
+}
@@ -0,0 +1,266 @@
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "Point.hpp"
+
+#define OPERATOR_SIZE	4096
+#define OPERATOR_REPEAT	256
+
+bool	bsp(Point const a, Point const b, Point const c, Point const point);
+
+/*
+ * Every Fixed operator against the same expression on float and double.
+ * Each op is one functor with a static apply(): the three types share the
+ * loop, and only the element type changes.
+ */
+
+/* min / max: Fixed has its own statics, float and double use the ternary */
+static const Fixed&	minOf(const Fixed& a, const Fixed& b)	{ return (Fixed::min(a, b)); }
+static const Fixed&	maxOf(const Fixed& a, const Fixed& b)	{ return (Fixed::max(a, b)); }
+template <typename T>
+static const T&		minOf(const T& a, const T& b)			{ return (a < b ? a : b); }
+template <typename T>
+static const T&		maxOf(const T& a, const T& b)			{ return (a > b ? a : b); }
+
+static int	toIntOf(const Fixed& a)		{ return (a.toInt()); }
+static int	toIntOf(const float& a)		{ return ((int)a); }
+static int	toIntOf(const double& a)	{ return ((int)a); }
+
+static float	toFloatOf(const Fixed& a)	{ return (a.toFloat()); }
+static float	toFloatOf(const float& a)	{ return (a); }
+static float	toFloatOf(const double& a)	{ return ((float)a); }
+
+struct	OpAdd	{ template <typename T> static T	apply(const T& a, const T& b) { return (a + b); } };
+struct	OpSub	{ template <typename T> static T	apply(const T& a, const T& b) { return (a - b); } };
+struct	OpMul	{ template <typename T> static T	apply(const T& a, const T& b) { return (a * b); } };
+struct	OpDiv	{ template <typename T> static T	apply(const T& a, const T& b) { return (a / b); } };
+struct	OpMin	{ template <typename T> static T	apply(const T& a, const T& b) { return (minOf(a, b)); } };
+struct	OpMax	{ template <typename T> static T	apply(const T& a, const T& b) { return (maxOf(a, b)); } };
+
+struct	OpGt	{ template <typename T> static bool	apply(const T& a, const T& b) { return (a > b); } };
+struct	OpLt	{ template <typename T> static bool	apply(const T& a, const T& b) { return (a < b); } };
+struct	OpGe	{ template <typename T> static bool	apply(const T& a, const T& b) { return (a >= b); } };
+struct	OpLe	{ template <typename T> static bool	apply(const T& a, const T& b) { return (a <= b); } };
+struct	OpEq	{ template <typename T> static bool	apply(const T& a, const T& b) { return (a == b); } };
+struct	OpNe	{ template <typename T> static bool	apply(const T& a, const T& b) { return (a != b); } };
+
+struct	OpPreInc	{ template <typename T> static T	apply(const T& a) { T x(a); return (++x); } };
+struct	OpPreDec	{ template <typename T> static T	apply(const T& a) { T x(a); return (--x); } };
+struct	OpPostInc	{ template <typename T> static T	apply(const T& a) { T x(a); return (x++); } };
+struct	OpPostDec	{ template <typename T> static T	apply(const T& a) { T x(a); return (x--); } };
+
+struct	OpToInt		{ template <typename T> static int		apply(const T& a) { return (toIntOf(a)); } };
+struct	OpToFloat	{ template <typename T> static float	apply(const T& a) { return (toFloatOf(a)); } };
+
+template <typename T>
+struct	Operands
+{
+	std::vector<T>	a;
+	std::vector<T>	b;
+
+	Operands(const std::vector<float>& lhs, const std::vector<float>& rhs) : a(lhs.begin(), lhs.end()), b(rhs.begin(), rhs.end()) {}
+};
+
+template <typename Op, typename T>
+static void	timeBinary(const char* name, const Operands<T>& in)
+{
+	std::vector<T>	out(OPERATOR_SIZE);
+	uint64_t		start = Bench::nowNs();
+
+	for (int r = 0; r < OPERATOR_REPEAT; r++)
+	{
+		for (size_t i = 0; i < OPERATOR_SIZE; i++)
+			out[i] = Op::apply(in.a[i], in.b[i]);
+		Bench::clobber();
+	}
+	Bench::report(name, Bench::nowNs() - start, (size_t)OPERATOR_SIZE * OPERATOR_REPEAT);
+}
+
+template <typename Op, typename T>
+static void	timeCompare(const char* name, const Operands<T>& in)
+{
+	size_t		count = 0;
+	uint64_t	start = Bench::nowNs();
+
+	for (int r = 0; r < OPERATOR_REPEAT; r++)
+	{
+		for (size_t i = 0; i < OPERATOR_SIZE; i++)
+			count += Op::apply(in.a[i], in.b[i]);
+		Bench::clobber();
+	}
+	Bench::report(name, Bench::nowNs() - start, (size_t)OPERATOR_SIZE * OPERATOR_REPEAT);
+	Bench::keep(count);
+}
+
+template <typename Op, typename R, typename T>
+static void	timeUnary(const char* name, const Operands<T>& in)
+{
+	std::vector<R>	out(OPERATOR_SIZE);
+	uint64_t		start = Bench::nowNs();
+
+	for (int r = 0; r < OPERATOR_REPEAT; r++)
+	{
+		for (size_t i = 0; i < OPERATOR_SIZE; i++)
+			out[i] = Op::apply(in.a[i]);
+		Bench::clobber();
+	}
+	Bench::report(name, Bench::nowNs() - start, (size_t)OPERATOR_SIZE * OPERATOR_REPEAT);
+}
+
+/* One line per type: "Fixed +", "float +", "double +" */
+template <typename Op>
+static void	binaryRow(const char* op, const Operands<Fixed>& f, const Operands<float>& s, const Operands<double>& d)
+{
+	timeBinary<Op>((std::string("Fixed ") + op).c_str(), f);
+	timeBinary<Op>((std::string("float ") + op).c_str(), s);
+	timeBinary<Op>((std::string("double ") + op).c_str(), d);
+}
+
+template <typename Op>
+static void	compareRow(const char* op, const Operands<Fixed>& f, const Operands<float>& s, const Operands<double>& d)
+{
+	timeCompare<Op>((std::string("Fixed ") + op).c_str(), f);
+	timeCompare<Op>((std::string("float ") + op).c_str(), s);
+	timeCompare<Op>((std::string("double ") + op).c_str(), d);
+}
+
+template <typename Op>
+static void	incrementRow(const char* op, const Operands<Fixed>& f, const Operands<float>& s, const Operands<double>& d)
+{
+	timeUnary<Op, Fixed>((std::string("Fixed ") + op).c_str(), f);
+	timeUnary<Op, float>((std::string("float ") + op).c_str(), s);
+	timeUnary<Op, double>((std::string("double ") + op).c_str(), d);
+}
+
+template <typename Op, typename R>
+static void	unaryRow(const char* op, const Operands<Fixed>& f, const Operands<float>& s, const Operands<double>& d)
+{
+	timeUnary<Op, R>((std::string("Fixed ") + op).c_str(), f);
+	timeUnary<Op, R>((std::string("float ") + op).c_str(), s);
+	timeUnary<Op, R>((std::string("double ") + op).c_str(), d);
+}
+
+/* bsp() in float / double: the same barycentric formula as srcs/bsp.cpp */
+template <typename T>
+static bool	bspOf(const T* a, const T* b, const T* c, const T* p)
+{
+	const T	s1 = c[1] - a[1];
+	const T	s2 = c[0] - a[0];
+	const T	s3 = b[1] - a[1];
+	const T	s4 = p[1] - a[1];
+	const T	denominator = s3 * s2 - (b[0] - a[0]) * s1;
+
+	if (denominator == 0)
+		return (false);
+
+	const T	w1 = (a[0] * s1 + s4 * s2 - p[0] * s1) / denominator;
+	T		w2;
+
+	if (s1 == 0)
+	{
+		if (s2 == 0)
+			return (false);
+		w2 = (p[0] - a[0] - w1 * (b[0] - a[0])) / s2;
+	}
+	else
+		w2 = (s4 - w1 * s3) / s1;
+	return (w1 > 0 && w2 > 0 && (w1 + w2) < 1);
+}
+
+template <typename T>
+static void	timeBsp(const char* name, const std::vector<float>& xs, const std::vector<float>& ys)
+{
+	const T			a[2] = {(T)-6.5f, (T)-4.25f};
+	const T			b[2] = {(T)7.75f, (T)-1.5f};
+	const T			c[2] = {(T)0.5f, (T)8.0f};
+	std::vector<T>	points(xs.size() * 2);
+	size_t			count = 0;
+
+	for (size_t i = 0; i < xs.size(); i++)
+	{
+		points[i * 2] = xs[i];
+		points[i * 2 + 1] = ys[i];
+	}
+
+	uint64_t	start = Bench::nowNs();
+
+	for (int r = 0; r < OPERATOR_REPEAT / 16; r++)
+		for (size_t i = 0; i < xs.size(); i++)
+			count += bspOf(a, b, c, &points[i * 2]);
+	Bench::report(name, Bench::nowNs() - start, xs.size() * (OPERATOR_REPEAT / 16));
+	Bench::keep(count);
+}
+
+void	benchOperators(void)
+{
+	std::vector<float>	lhs(OPERATOR_SIZE);
+	std::vector<float>	rhs(OPERATOR_SIZE);
+
+	// |a * b| < 2^14 and |b| >= 0.5: no Fixed overflow, no division by 0
+	srand(11);
+	for (size_t i = 0; i < OPERATOR_SIZE; i++)
+	{
+		lhs[i] = (rand() % 25601 - 12800) / 128.0f;
+		rhs[i] = (rand() % 12737 + 64) / 128.0f * (rand() % 2 ? 1 : -1);
+		if (i % 8 == 0)
+			lhs[i] = rhs[i];	// some equal pairs for == / !=
+	}
+
+	const Operands<Fixed>	f(lhs, rhs);
+	const Operands<float>	s(lhs, rhs);
+	const Operands<double>	d(lhs, rhs);
+
+	Bench::section("Fixed operators vs float vs double (4096 elements)");
+	binaryRow<OpAdd>("+", f, s, d);
+	binaryRow<OpSub>("-", f, s, d);
+	binaryRow<OpMul>("*", f, s, d);
+	binaryRow<OpDiv>("/", f, s, d);
+	binaryRow<OpMin>("min", f, s, d);
+	binaryRow<OpMax>("max", f, s, d);
+	compareRow<OpGt>(">", f, s, d);
+	compareRow<OpLt>("<", f, s, d);
+	compareRow<OpGe>(">=", f, s, d);
+	compareRow<OpLe>("<=", f, s, d);
+	compareRow<OpEq>("==", f, s, d);
+	compareRow<OpNe>("!=", f, s, d);
+	incrementRow<OpPreInc>("++x", f, s, d);
+	incrementRow<OpPreDec>("--x", f, s, d);
+	incrementRow<OpPostInc>("x++", f, s, d);
+	incrementRow<OpPostDec>("x--", f, s, d);
+	unaryRow<OpToInt, int>("toInt", f, s, d);
+	unaryRow<OpToFloat, float>("toFloat", f, s, d);
+
+	Bench::section("bsp() vs the same formula in float / double");
+	{
+		std::vector<Point>	points;
+		const Point			a(-6.5f, -4.25f);
+		const Point			b(7.75f, -1.5f);
+		const Point			c(0.5f, 8.0f);
+		size_t				count = 0;
+
+		points.reserve(OPERATOR_SIZE);
+		for (size_t i = 0; i < OPERATOR_SIZE; i++)
+			points.push_back(Point(lhs[i] / 10, rhs[i] / 10));
+
+		uint64_t	start = Bench::nowNs();
+
+		for (int r = 0; r < OPERATOR_REPEAT / 16; r++)
+			for (size_t i = 0; i < OPERATOR_SIZE; i++)
+				count += bsp(a, b, c, points[i]);
+		Bench::report("Fixed bsp()", Bench::nowNs() - start, (size_t)OPERATOR_SIZE * (OPERATOR_REPEAT / 16));
+		Bench::keep(count);
+
+		std::vector<float>	xs(OPERATOR_SIZE);
+		std::vector<float>	ys(OPERATOR_SIZE);
+
+		for (size_t i = 0; i < OPERATOR_SIZE; i++)
+		{
+			xs[i] = points[i].getX().toFloat();
+			ys[i] = points[i].getY().toFloat();
+		}
+		timeBsp<float>("float bsp", xs, ys);
+		timeBsp<double>("double bsp", xs, ys);
+	}
+}
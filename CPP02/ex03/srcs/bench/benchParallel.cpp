@@ -0,0 +1,94 @@
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "Bench.hpp"
+#include "ParallelBsp.hpp"
+
+#define PARALLEL_POINTS		(1 << 22)
+#define PARALLEL_SIDE		100			// 20000 triangles for locate()
+#define PARALLEL_REPEAT		4
+
+static float	randomCoordinate(void)
+{
+	return ((rand() % 200001 - 100000) / 100.0f);
+}
+
+static std::string	label(const char* what, unsigned int threads, double speedup)
+{
+	std::ostringstream	name;
+
+	name << what << " " << threads << "T (" << std::fixed << std::setprecision(2) << speedup << "x)";
+	return (name.str());
+}
+
+void	benchParallel(void)
+{
+	const long			online = sysconf(_SC_NPROCESSORS_ONLN);
+	const unsigned int	cores = online > 0 ? (unsigned int)online : 1;
+	PointCloud			cloud;
+	std::vector<Point>	mesh;
+	TriangleGrid		grid;
+	const TriangleQuery	triangle(Point(-600.0f, -500.0f), Point(700.0f, -200.0f), Point(50.0f, 800.0f));
+	std::vector<unsigned char>	inside(PARALLEL_POINTS);
+	std::vector<long>	located(PARALLEL_POINTS);
+	const float			step = 2000.0f / PARALLEL_SIDE;
+	uint64_t			baseClassify = 0;
+	uint64_t			baseLocate = 0;
+
+	srand(10);
+	cloud.reserve(PARALLEL_POINTS);
+	for (size_t i = 0; i < PARALLEL_POINTS; i++)
+		cloud.push_back(Point(randomCoordinate(), randomCoordinate()));
+	for (int row = 0; row < PARALLEL_SIDE; row++)
+		for (int column = 0; column < PARALLEL_SIDE; column++)
+		{
+			const float	x = -1000.0f + column * step;
+			const float	y = -1000.0f + row * step;
+
+			mesh.push_back(Point(x, y));
+			mesh.push_back(Point(x + step, y));
+			mesh.push_back(Point(x + step, y + step));
+			mesh.push_back(Point(x, y));
+			mesh.push_back(Point(x + step, y + step));
+			mesh.push_back(Point(x, y + step));
+		}
+	grid.build(&mesh[0], mesh.size() / 3);
+
+	// 1, 2, 4, ... and the core count itself
+	std::vector<unsigned int>	counts;
+
+	for (unsigned int threads = 1; threads < cores; threads *= 2)
+		counts.push_back(threads);
+	counts.push_back(cores);
+
+	Bench::section("ParallelBsp scaling (4M points, ns per point)");
+	for (size_t c = 0; c < counts.size(); c++)
+	{
+		const unsigned int	threads = counts[c];
+		ParallelBsp			pool(threads);
+		uint64_t	start;
+		uint64_t	elapsed;
+		size_t		found = 0;
+
+		start = Bench::nowNs();
+		for (int r = 0; r < PARALLEL_REPEAT; r++)
+			found += pool.classify(triangle, cloud.view(), &inside[0]);
+		elapsed = Bench::nowNs() - start;
+		baseClassify = threads == 1 ? elapsed : baseClassify;
+		Bench::report(label("classify", threads, (double)baseClassify / elapsed).c_str(),
+			elapsed, (size_t)PARALLEL_POINTS * PARALLEL_REPEAT);
+
+		start = Bench::nowNs();
+		for (int r = 0; r < PARALLEL_REPEAT; r++)
+			found += pool.locate(grid, cloud.view(), &located[0]);
+		elapsed = Bench::nowNs() - start;
+		baseLocate = threads == 1 ? elapsed : baseLocate;
+		Bench::report(label("locate", threads, (double)baseLocate / elapsed).c_str(),
+			elapsed, (size_t)PARALLEL_POINTS * PARALLEL_REPEAT);
+		Bench::keep(found);
+	}
+}
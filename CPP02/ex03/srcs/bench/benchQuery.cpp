@@ -0,0 +1,60 @@
+#include <vector>
+#include <cstdlib>
+
+#include "Bench.hpp"
+#include "TriangleQuery.hpp"
+
+#define QUERY_SIZE		4096
+#define QUERY_REPEAT	256
+
+bool	bsp(Point const a, Point const b, Point const c, Point const point);
+
+void	benchQuery(void)
+{
+	const Point					a(-6.5f, -4.25f);
+	const Point					b(7.75f, -1.5f);
+	const Point					c(0.5f, 8.0f);
+	const TriangleQuery			query(a, b, c);
+	std::vector<Point>			points;
+	PointCloud					cloud;
+	std::vector<unsigned char>	inside(QUERY_SIZE);
+	const size_t				ops = (size_t)QUERY_SIZE * QUERY_REPEAT;
+	uint64_t					start;
+
+	srand(8);
+	points.reserve(QUERY_SIZE);
+	for (size_t i = 0; i < QUERY_SIZE; i++)
+		points.push_back(Point((rand() % 2001 - 1000) / 100.0f, (rand() % 2001 - 1000) / 100.0f));
+	cloud.append(&points[0], QUERY_SIZE);
+
+	Bench::section("point in triangle (4096 points, ~19% inside)");
+
+	start = Bench::nowNs();
+	for (int r = 0; r < QUERY_REPEAT / 16; r++)
+		for (size_t i = 0; i < QUERY_SIZE; i++)
+		{
+			bool	result = bsp(a, b, c, points[i]);
+
+			Bench::keep(result);
+		}
+	Bench::report("bsp()", Bench::nowNs() - start, ops / 16);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < QUERY_REPEAT; r++)
+		for (size_t i = 0; i < QUERY_SIZE; i++)
+		{
+			bool	result = query.contains(points[i]);
+
+			Bench::keep(result);
+		}
+	Bench::report("TriangleQuery::contains", Bench::nowNs() - start, ops);
+
+	start = Bench::nowNs();
+	for (int r = 0; r < QUERY_REPEAT; r++)
+	{
+		size_t	count = query.classify(cloud.view(), &inside[0]);
+
+		Bench::keep(count);
+	}
+	Bench::report("TriangleQuery::classify", Bench::nowNs() - start, ops);
+}
@@ -0,0 +1,61 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+struct	BenchSection
+{
+	const char*	name;
+	void		(*run)(void);
+};
+
+static const BenchSection	g_sections[] = {
+	{"operators", &benchOperators},
+	{"kernels", &benchKernels},
+	{"division", &benchDivision},
+	{"convert", &benchConvert},
+	{"math", &benchMath},
+	{"decimal", &benchDecimal},
+	{"query", &benchQuery},
+	{"index", &benchIndex},
+	{"parallel", &benchParallel},
+};
+
+static const size_t	g_sectionCount = sizeof(g_sections) / sizeof(g_sections[0]);
+
+/* ./fixedBench [--json report.json] [section ...], every section by default */
+int	main(int ac, char **av)
+{
+	std::vector<std::string>	wanted;
+	const char*					jsonPath = NULL;
+
+	for (int arg = 1; arg < ac; arg++)
+	{
+		if (std::string(av[arg]) == "--json" && arg + 1 < ac)
+			jsonPath = av[++arg];
+		else
+			wanted.push_back(av[arg]);
+	}
+	for (size_t i = 0; i < g_sectionCount; i++)
+	{
+		bool	selected = wanted.empty();
+
+		for (size_t w = 0; w < wanted.size() && !selected; w++)
+			selected = (wanted[w] == g_sections[i].name);
+		if (selected)
+			g_sections[i].run();
+	}
+	if (jsonPath && !Bench::writeJson(jsonPath))
+	{
+		std::cerr << "fixedBench: cannot write " << jsonPath << std::endl;
+		return (1);
+	}
+	if (!wanted.empty())
+		return (0);
+	std::cout << std::endl << "sections:";
+	for (size_t i = 0; i < g_sectionCount; i++)
+		std::cout << " " << g_sections[i].name;
+	std::cout << std::endl;
+	return (0);
+}
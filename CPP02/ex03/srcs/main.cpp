@@ -1,5 +1,6 @@
 #include <iostream>
 
+#include "FixedPoint.hpp"
 #include "Point.hpp"
 
 bool bsp( Point const a, Point const b, Point const c, Point const point);
@@ -310,6 +311,34 @@ void	testCaseAlmostOnEdge(void)
 	std::cout << std::endl;
 }
 
+void	testCaseFixedPointConversion(void)
+{
+	typedef FixedPoint<8, short, FixedSaturate>	SatFixed8_8;
+	typedef FixedPoint<8, short, FixedChecked>	CheckedFixed8_8;
+
+	std::cout << CYAN "TEST 19: FixedPoint conversions between widths" << RESET << std::endl;
+
+	FixedChecked::clear();
+	const bool	wideToNarrow = Fixed8_8(Fixed32_32(1.5)).getRawBits() == 384
+		&& Fixed8_8(Fixed32_32(-2.25)).getRawBits() == -576;
+	const bool	narrowToWide = Fixed32_32(Fixed8_8(1.5)).getRawBits() == 3LL << 31
+		&& Fixed16_16(Fixed8_8(-0.5)).getRawBits() == -(1 << 15);
+	const bool	saturated = SatFixed8_8(Fixed32_32(1000.0)).getRawBits() == 32767
+		&& SatFixed8_8(Fixed32_32(-1000.0)).getRawBits() == -32768;
+	const bool	inRange = CheckedFixed8_8(Fixed32_32(100.0)).getRawBits() == 25600 && !FixedChecked::overflowed();
+
+	CheckedFixed8_8(Fixed32_32(1000.0));
+	const bool	checked = inRange && FixedChecked::overflowed();
+
+	FixedChecked::clear();
+	if (wideToNarrow && narrowToWide && saturated && checked)
+		std::cout << GREEN "true: every conversion kept its value or applied its policy" << RESET << std::endl;
+	else
+		std::cout << RED "false: wide->narrow " << wideToNarrow << ", narrow->wide " << narrowToWide
+			<< ", saturate " << saturated << ", checked " << checked << RESET << std::endl;
+	std::cout << std::endl;
+}
+
 int	main(void)
 {
 	testCasePointIn();
@@ -340,5 +369,7 @@ int	main(void)
 	testCaseNegativePoint();
 	testCaseAlmostOnEdge();
 
+	testCaseFixedPointConversion();
+
 	return (0);
 }
@@ -0,0 +1,91 @@
+#ifndef BATTLEENGINE_HPP
+# define BATTLEENGINE_HPP
+
+# include <vector>
+# include <pthread.h>
+
+# include "UnitArena.hpp"
+
+/*
+ * Advances a whole UnitArena in ticks on a fixed number of threads, with
+ * a result that depends on the seed only, never on the thread count or
+ * the scheduling.
+ *
+ * Every tick is simultaneous: all decisions read the state of the start
+ * of the tick.
+ *  1. each thread walks its own slice of units (units / threads, rounded
+ *     up); a unit that can act repairs itself when low (beRepaired),
+ *     otherwise strikes a target picked by hashing (seed, tick, unit). Its
+ *     energy is spent right away (only its own thread touches it), the
+ *     strike goes into the thread's outbox for the slice of the target.
+ *  2. each thread reads the outboxes addressed to its slice only, sums
+ *     them in a slice-sized damage array (a saturating sum of unsigned
+ *     values: the order does not matter) and applies it with takeDamage
+ *     semantics.
+ * Memory is one damage array per slice plus the strikes of one tick, and
+ * both phases only touch 1 / threads of the units each.
+ * A barrier separates the phases. The battle ends after maxTicks or on
+ * the first tick where nobody could act.
+ */
+class BattleEngine {
+
+	private:
+		struct Strike {
+			UnitId			target;
+			unsigned int	damage;
+		};
+
+		struct Worker {
+			pthread_t					thread;
+			BattleEngine*				engine;
+			unsigned int				index;
+			size_t						strikes;
+			size_t						repairs;
+			size_t						kills;
+			bool						acted;
+			std::vector<unsigned int>			damage;		// its slice
+			std::vector<std::vector<Strike> >	outbox;		// one per slice
+		};
+
+		UnitArena&				_arena;
+		unsigned long long		_seed;
+		std::vector<Worker>		_workers;
+		pthread_barrier_t		_barrier;
+		pthread_mutex_t			_gate;
+		pthread_cond_t			_open;
+		unsigned int			_maxTicks;
+		unsigned int			_tick;
+		unsigned int			_active;
+		size_t					_sliceSize;
+		bool					_over;
+		bool					_started;
+		size_t					_strikes;
+		size_t					_repairs;
+		size_t					_kills;
+
+		BattleEngine(const BattleEngine& copyName);
+		BattleEngine&	operator=(const BattleEngine& copyName);
+
+		static void*	_routine(void* arg);
+		void			_fight(Worker& worker);
+		void			_act(Worker& worker, size_t begin, size_t end);
+		void			_resolve(Worker& worker, size_t begin, size_t end);
+
+	public:
+		enum { REPAIR_BELOW = 25, REPAIR_AMOUNT = 5 };
+
+		BattleEngine(UnitArena& arena, unsigned int threads, unsigned long long seed);
+		~BattleEngine(void);
+
+		unsigned int		run(unsigned int maxTicks);		// returns the ticks played
+		void				setTick(unsigned int tick);		// resume a battle saved at that tick
+
+		unsigned int		threads(void) const;		// threads of the last run
+		unsigned int		ticks(void) const;
+		size_t				strikes(void) const;
+		size_t				repairs(void) const;
+		size_t				kills(void) const;
+		unsigned long long	checksum(void) const;
+};
+
+#endif
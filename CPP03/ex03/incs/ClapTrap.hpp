@@ -12,10 +12,13 @@
 
 # include <iostream>
 
+# include "EventLog.hpp"
+
 class ClapTrap {
 
 	protected:							// rend accessible a la classe derivee les variables sans avoir a passer par un getter
 		std::string		_name;
+		NameId			_nameId;		// _name for the EventLog, cached by its first RECORD event
 		unsigned int	_hitPoints;		// HP en vrai -> start at 10
 		unsigned int	_energyPoints;	// starts at 10
 		unsigned int	_attackDamage;	// starts at 0
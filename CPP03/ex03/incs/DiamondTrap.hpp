@@ -9,6 +9,7 @@ class DiamondTrap : public ScavTrap, public FragTrap {
 
 	private:
 		std::string	_name;
+		NameId		_nameId;
 
 	public:
 		DiamondTrap(void);
@@ -0,0 +1,129 @@
+#ifndef EVENTLOG_HPP
+# define EVENTLOG_HPP
+
+# include <iostream>
+# include <string>
+
+# include "NameTable.hpp"
+
+/*
+ * Where the ClapTrap family reports what it does. Every constructor,
+ * destructor, operator= and action emits one compact record (kind, actor,
+ * target, amount) instead of writing to std::cout itself.
+ *
+ * ECHO	(default) renders the record right away: the text of before.
+ * RECORD	pushes the record into a lock-free ring (any number of
+ *			producers, one consumer); drain() hands the pending records to
+ *			a consumer, print() renders them as ECHO would have. A full
+ *			ring drops the record and counts it.
+ * SILENT	drops everything: a simulation runs without any I/O.
+ *
+ * The actor is a NameId each object caches next to its name: interned
+ * (under a lock) by its first RECORD event only, then a push is one CAS
+ * and a copy. A target of up to TARGET_SIZE characters is copied into the
+ * record, so everyday targets never grow a table; a longer one is interned
+ * (under the lock) in a table of its own and the record keeps its id, so
+ * the drained text is always the ECHO text.
+ */
+class EventLog {
+
+	public:
+		enum e_mode {
+			ECHO,
+			RECORD,
+			SILENT
+		};
+
+		enum e_eventKind {
+			CLAP_DEFAULT,
+			CLAP_NAMED,
+			CLAP_COPY,
+			CLAP_DESTROY,
+			CLAP_ATTACK,
+			CLAP_CANNOT_ATTACK,
+			CLAP_DAMAGE,
+			CLAP_DEATH,
+			CLAP_REPAIR,
+			CLAP_CANNOT_REPAIR,
+			CLAP_REPAIR_OVERFLOW,
+			SCAV_DEFAULT,
+			SCAV_NAMED,
+			SCAV_COPY,
+			SCAV_DESTROY,
+			SCAV_ATTACK,
+			SCAV_CANNOT_ATTACK,
+			SCAV_GUARD_GATE,
+			SCAV_CANNOT_GUARD_GATE,
+			FRAG_DEFAULT,
+			FRAG_NAMED,
+			FRAG_COPY,
+			FRAG_DESTROY,
+			FRAG_ATTACK,
+			FRAG_CANNOT_ATTACK,
+			FRAG_HIGH_FIVES,
+			FRAG_CANNOT_HIGH_FIVE,
+			DIAMOND_DEFAULT,
+			DIAMOND_NAMED,
+			DIAMOND_COPY,
+			DIAMOND_DESTROY,
+			DIAMOND_WHO_AM_I,
+			COPY_ASSIGNMENT,
+			EVENT_KINDS
+		};
+
+		enum { UNNAMED = ~0u };			// a name not interned yet
+		enum { TARGET_SIZE = 38 };		// an Event is 48 bytes
+		enum { LONG_TARGET = 0xFF };	// targetSize of a target interned, its NameId in target
+
+		struct Event {
+			NameId			actor;
+			unsigned int	amount;
+			unsigned char	kind;
+			unsigned char	targetSize;		// up to TARGET_SIZE, or LONG_TARGET
+			char			target[TARGET_SIZE];
+		};
+
+		typedef void	(*Consumer)(const Event& event);
+
+		enum { CAPACITY = 1 << 16 };	// records, a power of two
+
+	private:
+		struct Slot {
+			unsigned long	stamp;		// lap of the position it is free (+0) or full (+1) for
+			Event			event;
+		};
+
+		static e_mode			_mode;
+		static Slot				_ring[CAPACITY];
+		static unsigned long	_head;
+		static unsigned long	_tail;
+		static unsigned long	_dropped;
+
+		EventLog(void);
+		EventLog(const EventLog& copyName);
+		~EventLog(void);
+		EventLog&	operator=(const EventLog& copyName);
+
+		static void		_push(e_eventKind kind, const std::string& actor, NameId& actorId,
+							const std::string& target, unsigned int amount);
+		static void		_render(std::ostream& out, unsigned int kind, const std::string& actor,
+							const std::string& target, unsigned int amount);
+
+	public:
+		static void			setMode(e_mode mode);
+		static e_mode		mode(void);
+
+		// actorId: the actor's cached NameId, UNNAMED until its first RECORD event
+		static void			emit(e_eventKind kind, const std::string& actor, NameId& actorId, unsigned int amount = 0);
+		static void			emit(e_eventKind kind, const std::string& actor, NameId& actorId,
+								const std::string& target, unsigned int amount = 0);
+
+		static size_t		drain(Consumer consumer);		// single consumer, returns the records consumed
+		static void			print(const Event& event);		// consumer rendering to std::cout
+		static void			render(std::ostream& out, const Event& event);
+		static std::string	name(NameId id);
+		static std::string	target(const Event& event);
+		static size_t		dropped(void);
+};
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef NAMETABLE_HPP
+# define NAMETABLE_HPP
+
+# include <string>
+# include <vector>
+# include <map>
+
+typedef unsigned int	NameId;
+
+/*
+ * Interned unit names: every distinct name is stored once and units keep
+ * a 32-bit NameId instead of their own std::string, so a million units
+ * named "Scav" cost one string.
+ */
+class NameTable {
+
+	private:
+		std::vector<std::string>		_names;
+		std::map<std::string, NameId>	_ids;
+
+	public:
+		NameTable(void);
+		NameTable(const NameTable& copyName);
+
+		~NameTable(void);
+
+		NameTable&	operator=(const NameTable& copyName);
+
+		NameId				intern(const std::string& name);
+		const std::string&	get(NameId id) const;
+		size_t				size(void) const;
+		void				clear(void);
+};
+
+#endif
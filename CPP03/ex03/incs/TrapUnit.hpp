@@ -0,0 +1,60 @@
+#ifndef TRAPUNIT_HPP
+# define TRAPUNIT_HPP
+
+# include <string>
+
+# include "UnitArena.hpp"
+
+/*
+ * One unit of the ClapTrap family as a tagged union instead of a class
+ * hierarchy: the kind is a field, the stats sit right in the object and
+ * every method switches on the kind. No vtable, no virtual base: a
+ * DiamondTrap's stats are at the same offset as a ClapTrap's, where the
+ * classes reach them through the vbase pointer.
+ *
+ * Stats and actions are the classes' ones, events included (attack of a
+ * DiamondTrap is ScavTrap's); guardGate and highFivesGuys do nothing for
+ * the kinds that do not have them. Construction, copy and destruction are
+ * silent: there is no constructor chain to report.
+ */
+class TrapUnit {
+
+	private:
+		std::string		_name;			// ClapTrap::_name
+		std::string		_diamondName;	// DiamondTrap::_name, empty for the other kinds
+		NameId			_nameId;		// both for the EventLog
+		NameId			_diamondNameId;
+		unsigned int	_hitPoints;
+		unsigned int	_energyPoints;
+		unsigned int	_attackDamage;
+		e_unitKind		_kind;
+
+		void	_spawn(e_unitKind kind);
+
+	public:
+		TrapUnit(void);									// a default ClapTrap
+		TrapUnit(e_unitKind kind);						// the default constructor of kind
+		TrapUnit(e_unitKind kind, const std::string& name);
+		TrapUnit(const TrapUnit& copyName);
+
+		~TrapUnit(void);
+
+		TrapUnit&	operator=(const TrapUnit& copyName);
+
+		e_unitKind			kind(void) const;
+		const std::string&	name(void) const;
+		unsigned int		hitPoints(void) const;
+		unsigned int		energyPoints(void) const;
+		unsigned int		attackDamage(void) const;
+
+		void	clapTrapState(void) const;
+
+		void	attack(const std::string& target);
+		void	takeDamage(unsigned int amount);
+		void	beRepaired(unsigned int amount);
+		void	guardGate(void);
+		void	highFivesGuys(void);
+		void	whoAmI(void);
+};
+
+#endif
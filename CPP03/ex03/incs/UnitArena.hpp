@@ -0,0 +1,100 @@
+#ifndef UNITARENA_HPP
+# define UNITARENA_HPP
+
+# include <string>
+# include <vector>
+
+# include "NameTable.hpp"
+
+typedef unsigned int	UnitId;
+
+enum e_unitKind {
+	UNIT_CLAPTRAP,
+	UNIT_SCAVTRAP,
+	UNIT_FRAGTRAP,
+	UNIT_DIAMONDTRAP
+};
+
+struct UnitStats {
+	const char*		name;
+	unsigned int	hitPoints;
+	unsigned int	energyPoints;
+	unsigned int	attackDamage;
+};
+
+/*
+ * The ClapTrap family as parallel arrays: unit i is _hitPoints[i],
+ * _energyPoints[i], _attackDamage[i], its kind and its interned name, so
+ * a million units are five flat arrays instead of a million objects with
+ * their own std::string. Units are plain indices (UnitId).
+ *
+ * The actions follow the classes exactly, without printing:
+ *  - attack, guardGate, highFivesGuys: need hit points and energy, cost 1
+ *    energy point (guardGate: ScavTrap and DiamondTrap only, highFivesGuys:
+ *    FragTrap and DiamondTrap only)
+ *  - takeDamage: hit points drop, clamped at 0
+ *  - beRepaired: needs hit points and energy, refused without cost when it
+ *    would go past UINT_MAX
+ * The batch takeDamage and beRepaired do the same over a range of units
+ * with saturating SIMD arithmetic (SSE2, AVX2 when built for it): same
+ * energy checks, same results bit for bit.
+ * Spawned stats are the constructors' ones (DiamondTrap: FragTrap's hit
+ * points and damage, ScavTrap's energy).
+ */
+class UnitArena {
+
+	private:
+		std::vector<unsigned int>	_hitPoints;
+		std::vector<unsigned int>	_energyPoints;
+		std::vector<unsigned int>	_attackDamage;
+		std::vector<unsigned char>	_kind;
+		std::vector<NameId>			_name;
+		NameTable					_names;
+
+		friend class	UnitSnapshot;		// saves and restores the arrays as they are
+
+	public:
+		UnitArena(void);
+		UnitArena(const UnitArena& copyName);
+
+		~UnitArena(void);
+
+		UnitArena&	operator=(const UnitArena& copyName);
+
+		UnitId		spawn(e_unitKind kind, const std::string& name);
+		UnitId		spawn(e_unitKind kind, const std::string& name, size_t count);	// first id of count
+		size_t		size(void) const;
+		void		reserve(size_t capacity);
+		void		clear(void);
+
+		e_unitKind			kind(UnitId unit) const;
+		const std::string&	name(UnitId unit) const;
+		std::string			clapName(UnitId unit) const;	// DiamondTrap's ClapTrap::_name
+		unsigned int		hitPoints(UnitId unit) const;
+		unsigned int		energyPoints(UnitId unit) const;
+		unsigned int		attackDamage(UnitId unit) const;
+		bool				alive(UnitId unit) const;
+
+		// the stat arrays themselves, size() long, for bulk kernels
+		unsigned int*		hitPointsData(void);
+		unsigned int*		energyPointsData(void);
+		unsigned int*		attackDamageData(void);
+
+		bool		attack(UnitId unit);
+		bool		strike(UnitId attacker, UnitId target);		// attack, then target takes the damage
+		void		takeDamage(UnitId unit, unsigned int amount);
+		bool		beRepaired(UnitId unit, unsigned int amount);
+		bool		guardGate(UnitId unit);
+		bool		highFivesGuys(UnitId unit);
+
+		// units [first, first + count) each get amounts[i - first], as the methods above would
+		void		takeDamage(UnitId first, size_t count, const unsigned int* amounts);
+		size_t		beRepaired(UnitId first, size_t count, const unsigned int* amounts);	// units repaired
+
+		void		unitState(UnitId unit) const;	// clapTrapState() for one unit
+
+		static const char*			kindName(e_unitKind kind);
+		static const UnitStats&		spawnStats(e_unitKind kind);
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef UNITSNAPSHOT_HPP
+# define UNITSNAPSHOT_HPP
+
+# include <string>
+# include <stdint.h>
+
+# include "UnitArena.hpp"
+
+# define SNAPSHOT_MAGIC	"CLAPSNP1"
+
+/*
+ * File layout (host endianness, every section starts 8-byte aligned):
+ *
+ *   header       : magic[8] | units u64 | names u64 | textSize u64 | tick u32 | 0 u32
+ *   hitPoints    : u32[units]
+ *   energyPoints : u32[units]
+ *   attackDamage : u32[units]
+ *   name         : u32[units]		NameId, index in the name sections
+ *   kind         : u8[units]
+ *   nameEnd      : u64[names]		end of each name in text
+ *   text         : char[textSize]	the names back to back, no terminator
+ *
+ * So the arrays are UnitArena's own arrays, byte for byte: a snapshot is
+ * mmapped and used in place, restore() is a few memcpy. tick is free for
+ * the caller: the BattleEngine tick to resume at, an unsigned int like
+ * BattleEngine's (the 4 bytes after it keep the header 8-byte aligned).
+ */
+struct	SnapshotHeader
+{
+	char		magic[8];
+	uint64_t	units;
+	uint64_t	names;
+	uint64_t	textSize;
+	uint32_t	tick;
+	uint32_t	reserved;
+};
+
+class UnitSnapshot {
+
+	private:
+		void*					_map;
+		size_t					_mapSize;
+		const SnapshotHeader*	_header;
+		const unsigned int*		_hitPoints;
+		const unsigned int*		_energyPoints;
+		const unsigned int*		_attackDamage;
+		const NameId*			_name;
+		const unsigned char*	_kind;
+		const uint64_t*			_nameEnd;
+		const char*				_text;
+
+		UnitSnapshot(const UnitSnapshot& copyName);
+		UnitSnapshot&	operator=(const UnitSnapshot& copyName);
+
+	public:
+		UnitSnapshot(const std::string& path);		// maps the file, see isOpen()
+		~UnitSnapshot(void);
+
+		bool				isOpen(void) const;		// mapped and well formed
+		size_t				size(void) const;
+		size_t				nameCount(void) const;
+		unsigned int		tick(void) const;
+
+		// in place views, not checked: restore() is
+		const unsigned int*		hitPoints(void) const;
+		const unsigned int*		energyPoints(void) const;
+		const unsigned int*		attackDamage(void) const;
+		const NameId*			nameIds(void) const;
+		const unsigned char*	kinds(void) const;
+		std::string				name(NameId id) const;
+
+		bool		restore(UnitArena& arena) const;	// false, arena untouched, on bad ids or kinds
+
+		static bool	save(const UnitArena& arena, const std::string& path, unsigned int tick = 0);
+};
+
+#endif
@@ -1,11 +1,23 @@
 override SRCSDIR	:= srcs/
 override SRCS		= $(addprefix $(SRCSDIR), $(SRC))
+override BENCH_SRCS	= $(addprefix $(SRCSDIR), $(addsuffix .cpp, $(LIB) $(BENCH_MAIN)))
 
-SRC	+= $(addsuffix .cpp, $(MAIN))
+SRC	+= $(addsuffix .cpp, $(LIB) $(MAIN))
 
-override MAIN			:= \
+override LIB			:= \
+	BattleEngine \
 	ClapTrap \
 	DiamondTrap \
+	EventLog \
 	FragTrap \
-	main \
-	ScavTrap
+	NameTable \
+	ScavTrap \
+	TrapUnit \
+	UnitArena \
+	UnitSnapshot
+
+override MAIN			:= \
+	main
+
+override BENCH_MAIN		:= \
+	bench/main
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <climits>
+
+#include "BattleEngine.hpp"
+
+/* splitmix64 finaliser: the target of a unit for a tick */
+static unsigned long long	mix(unsigned long long x) {
+	x ^= x >> 30;
+	x *= 0xBF58476D1CE4E5B9ULL;
+	x ^= x >> 27;
+	x *= 0x94D049BB133111EBULL;
+	return (x ^ (x >> 31));
+}
+
+static unsigned int	saturatingAdd(unsigned int a, unsigned int b) {
+	return (a > UINT_MAX - b ? UINT_MAX : a + b);
+}
+
+BattleEngine::BattleEngine(UnitArena& arena, unsigned int threads, unsigned long long seed)
+	: _arena(arena), _seed(seed), _maxTicks(0), _tick(0), _active(1), _sliceSize(0), _over(false), _started(false), _strikes(0), _repairs(0), _kills(0) {
+
+	if (threads == 0)
+		threads = 1;
+	this->_workers.resize(threads);
+	for (unsigned int i = 0; i < threads; i++) {
+		this->_workers[i].engine = this;
+		this->_workers[i].index = i;
+		this->_workers[i].strikes = 0;
+		this->_workers[i].repairs = 0;
+		this->_workers[i].kills = 0;
+		this->_workers[i].acted = false;
+	}
+	pthread_mutex_init(&this->_gate, NULL);
+	pthread_cond_init(&this->_open, NULL);
+}
+
+BattleEngine::~BattleEngine(void) {
+	pthread_cond_destroy(&this->_open);
+	pthread_mutex_destroy(&this->_gate);
+}
+
+
+unsigned int	BattleEngine::threads(void) const {
+	return (this->_active);
+}
+
+void	BattleEngine::setTick(unsigned int tick) {
+	this->_tick = tick;
+}
+
+unsigned int	BattleEngine::ticks(void) const {
+	return (this->_tick);
+}
+
+size_t	BattleEngine::strikes(void) const {
+	return (this->_strikes);
+}
+
+size_t	BattleEngine::repairs(void) const {
+	return (this->_repairs);
+}
+
+size_t	BattleEngine::kills(void) const {
+	return (this->_kills);
+}
+
+/* FNV-1a over the three stat arrays: equal checksums, equal battles */
+unsigned long long	BattleEngine::checksum(void) const {
+
+	unsigned long long	hash = 0xCBF29CE484222325ULL;
+
+	for (UnitId unit = 0; unit < this->_arena.size(); unit++) {
+		const unsigned int	stats[3] = {this->_arena.hitPoints(unit), this->_arena.energyPoints(unit),
+			this->_arena.attackDamage(unit)};
+
+		for (int s = 0; s < 3; s++)
+			hash = (hash ^ stats[s]) * 0x100000001B3ULL;
+	}
+	return (hash);
+}
+
+
+void	BattleEngine::_act(Worker& worker, size_t begin, size_t end) {
+
+	const size_t		units = this->_arena.size();
+	unsigned int*		hitPoints = this->_arena.hitPointsData();
+	unsigned int*		energyPoints = this->_arena.energyPointsData();
+	const unsigned int*	attackDamage = this->_arena.attackDamageData();
+
+	for (size_t unit = begin; unit < end; unit++) {
+		if (energyPoints[unit] == 0 || hitPoints[unit] == 0)
+			continue ;
+		if (hitPoints[unit] < REPAIR_BELOW) {
+			// beRepaired: REPAIR_AMOUNT cannot overflow below REPAIR_BELOW
+			energyPoints[unit]--;
+			hitPoints[unit] += REPAIR_AMOUNT;
+			worker.repairs++;
+			continue ;
+		}
+
+		size_t	target = mix(this->_seed ^ ((unsigned long long)this->_tick << 40) ^ unit) % units;
+
+		if (target == unit)
+			target = (target + 1) % units;
+		const Strike	strike = {(UnitId)target, attackDamage[unit]};
+
+		energyPoints[unit]--;
+		worker.outbox[target / this->_sliceSize].push_back(strike);
+		worker.strikes++;
+	}
+}
+
+void	BattleEngine::_resolve(Worker& worker, size_t begin, size_t end) {
+
+	unsigned int*				hitPoints = this->_arena.hitPointsData();
+	std::vector<unsigned int>&	damage = worker.damage;		// damage[unit - begin]
+
+	// only the strikes addressed to this slice, from every thread
+	for (unsigned int w = 0; w < this->_active; w++) {
+		std::vector<Strike>&	inbox = this->_workers[w].outbox[worker.index];
+
+		for (size_t i = 0; i < inbox.size(); i++)
+			damage[inbox[i].target - begin] = saturatingAdd(damage[inbox[i].target - begin], inbox[i].damage);
+		inbox.clear();
+	}
+	for (size_t unit = begin; unit < end; unit++) {
+		const unsigned int	total = damage[unit - begin];
+
+		if (total == 0)
+			continue ;
+		damage[unit - begin] = 0;
+		if (total >= hitPoints[unit]) {
+			worker.kills += (hitPoints[unit] != 0);
+			hitPoints[unit] = 0;
+		}
+		else
+			hitPoints[unit] -= total;
+	}
+}
+
+void	BattleEngine::_fight(Worker& worker) {
+
+	const size_t	units = this->_arena.size();
+	const size_t	begin = std::min(units, worker.index * this->_sliceSize);
+	const size_t	end = std::min(units, begin + this->_sliceSize);
+
+	while (!this->_over) {
+		const size_t	before = worker.strikes + worker.repairs;
+
+		this->_act(worker, begin, end);
+		worker.acted = (worker.strikes + worker.repairs != before);
+		pthread_barrier_wait(&this->_barrier);
+		this->_resolve(worker, begin, end);
+		pthread_barrier_wait(&this->_barrier);
+		if (worker.index == 0) {
+			bool	acted = false;
+
+			for (unsigned int w = 0; w < this->_active; w++)
+				acted |= this->_workers[w].acted;
+			this->_tick++;
+			this->_over = (!acted || this->_tick >= this->_maxTicks);
+		}
+		pthread_barrier_wait(&this->_barrier);
+	}
+}
+
+void*	BattleEngine::_routine(void* arg) {
+
+	Worker&			worker = *static_cast<Worker*>(arg);
+	BattleEngine&	engine = *worker.engine;
+
+	pthread_mutex_lock(&engine._gate);
+	while (!engine._started)
+		pthread_cond_wait(&engine._open, &engine._gate);
+	pthread_mutex_unlock(&engine._gate);
+	if (worker.index < engine._active)
+		engine._fight(worker);
+	return (NULL);
+}
+
+unsigned int	BattleEngine::run(unsigned int maxTicks) {
+
+	const unsigned int	startTick = this->_tick;
+	unsigned int		created = 1;
+
+	if (this->_arena.size() < 2 || maxTicks == 0)
+		return (0);
+	this->_maxTicks = this->_tick + maxTicks;
+	this->_over = false;
+	this->_started = false;
+	// threads wait at the gate until we know how many of them we got
+	while (created < this->_workers.size()
+		&& pthread_create(&this->_workers[created].thread, NULL, &BattleEngine::_routine, &this->_workers[created]) == 0)
+		created++;
+	this->_active = created;
+	this->_sliceSize = (this->_arena.size() + this->_active - 1) / this->_active;
+	for (unsigned int w = 0; w < this->_active; w++) {
+		this->_workers[w].damage.assign(this->_sliceSize, 0);
+		this->_workers[w].outbox.assign(this->_active, std::vector<Strike>());
+	}
+	pthread_barrier_init(&this->_barrier, NULL, this->_active);
+	pthread_mutex_lock(&this->_gate);
+	this->_started = true;
+	pthread_cond_broadcast(&this->_open);
+	pthread_mutex_unlock(&this->_gate);
+
+	this->_fight(this->_workers[0]);
+	for (unsigned int w = 1; w < created; w++)
+		pthread_join(this->_workers[w].thread, NULL);
+	pthread_barrier_destroy(&this->_barrier);
+
+	this->_strikes = 0;
+	this->_repairs = 0;
+	this->_kills = 0;
+	for (size_t w = 0; w < this->_workers.size(); w++) {
+		this->_strikes += this->_workers[w].strikes;
+		this->_repairs += this->_workers[w].repairs;
+		this->_kills += this->_workers[w].kills;
+		std::vector<unsigned int>().swap(this->_workers[w].damage);
+		std::vector<std::vector<Strike> >().swap(this->_workers[w].outbox);
+	}
+	return (this->_tick - startTick);
+}
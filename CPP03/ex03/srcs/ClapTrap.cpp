@@ -2,29 +2,30 @@
 
 #include "ClapTrap.hpp"
 
-ClapTrap::ClapTrap(void) : _name("Dumb"), _hitPoints(10), _energyPoints(10), _attackDamage(0) {
-	std::cout << YELLOW "Default constructor called" RESET << std::endl;
+ClapTrap::ClapTrap(void) : _name("Dumb"), _nameId(EventLog::UNNAMED), _hitPoints(10), _energyPoints(10), _attackDamage(0) {
+	EventLog::emit(EventLog::CLAP_DEFAULT, this->_name, this->_nameId);
 }
 
-ClapTrap::ClapTrap(std::string name) : _name(name), _hitPoints(10), _energyPoints(10), _attackDamage(0) {
-	std::cout << YELLOW "Constructor by name called" RESET << std::endl;
+ClapTrap::ClapTrap(std::string name) : _name(name), _nameId(EventLog::UNNAMED), _hitPoints(10), _energyPoints(10), _attackDamage(0) {
+	EventLog::emit(EventLog::CLAP_NAMED, this->_name, this->_nameId);
 }
 
-ClapTrap::ClapTrap(const ClapTrap& copyName) {
+ClapTrap::ClapTrap(const ClapTrap& copyName) : _nameId(EventLog::UNNAMED) {
 	*this = copyName;
-	std::cout << GREEN "Copy constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::CLAP_COPY, this->_name, this->_nameId);
 }
 
 ClapTrap::~ClapTrap(void) {
-	std::cout << "Destructor called" << std::endl;
+	EventLog::emit(EventLog::CLAP_DESTROY, this->_name, this->_nameId);
 }
 
 ClapTrap&	ClapTrap::operator=(const ClapTrap& copyName) {
 
-	std::cout << BLUE "Copy assignment operator called" RESET << std::endl;
+	EventLog::emit(EventLog::COPY_ASSIGNMENT, this->_name, this->_nameId);
 
 	if (this != &copyName) {
 		this->_name = copyName._name;
+		this->_nameId = copyName._nameId;
 		this->_hitPoints = copyName._hitPoints;
 		this->_energyPoints = copyName._energyPoints;
 		this->_attackDamage = copyName._attackDamage;
@@ -36,35 +37,35 @@ ClapTrap&	ClapTrap::operator=(const ClapTrap& copyName) {
 
 void	ClapTrap::attack(const std::string& target) {
 	if (_energyPoints == 0 || _hitPoints == 0) {
-		std::cout << RED "ClapTrap " << _name << " cannot attack " << target << "." RESET << std::endl;
+		EventLog::emit(EventLog::CLAP_CANNOT_ATTACK, _name, _nameId, target);
 		return ;
 	}
 	_energyPoints--;
-	std::cout << MAGENTA "ClapTrap " << _name << " attacks " << target << ", causing " << _attackDamage << " points of damage!" RESET << std::endl;
+	EventLog::emit(EventLog::CLAP_ATTACK, _name, _nameId, target, _attackDamage);
 }
 
 void	ClapTrap::takeDamage(unsigned int amount) {
 	if (amount >= _hitPoints) {
 		_hitPoints = 0;
-		std::cout << MAGENTA "ClapTrap " << _name << " took " << amount << " of damage, causing them to die!" RESET << std::endl;
+		EventLog::emit(EventLog::CLAP_DEATH, _name, _nameId, amount);
 		return ;
 	}
 	_hitPoints -= amount;
-	std::cout << MAGENTA "ClapTrap" << _name << " took " << amount << " of damage!" RESET << std::endl;
+	EventLog::emit(EventLog::CLAP_DAMAGE, _name, _nameId, amount);
 }
 
 void	ClapTrap::beRepaired(unsigned int amount) {
 	if (_energyPoints == 0 || _hitPoints == 0) {
-		std::cout << RED "ClapTrap " << _name << " cannot repair." RESET << std::endl;
+		EventLog::emit(EventLog::CLAP_CANNOT_REPAIR, _name, _nameId);
 		return ;
 	}
 	if ((UINT_MAX - amount) < _hitPoints) {
-		std::cout << RED "ClapTrap " << _name << " cannot have more than " << UINT_MAX << " hit points!" RESET << std::endl;
+		EventLog::emit(EventLog::CLAP_REPAIR_OVERFLOW, _name, _nameId, UINT_MAX);
 		return ;
 	}
 	_energyPoints--;
 	_hitPoints += amount;
-	std::cout << MAGENTA "ClapTrap " << _name << " repaired for " << amount << " of hit points!" RESET << std::endl;
+	EventLog::emit(EventLog::CLAP_REPAIR, _name, _nameId, amount);
 
 }
 
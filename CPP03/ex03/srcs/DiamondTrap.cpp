@@ -1,41 +1,42 @@
 #include "DiamondTrap.hpp"
 
-DiamondTrap::DiamondTrap(void) : ClapTrap("unknown_clap_name"), ScavTrap(), FragTrap(), _name("Diamond") {
+DiamondTrap::DiamondTrap(void) : ClapTrap("unknown_clap_name"), ScavTrap(), FragTrap(), _name("Diamond"), _nameId(EventLog::UNNAMED) {
 
 	_hitPoints = 100;
 	_energyPoints = 50;
 	_attackDamage = 30;
 
-	std::cout << YELLOW "Default DiamondTrap constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::DIAMOND_DEFAULT, this->_name, this->_nameId);
 }
 
-DiamondTrap::DiamondTrap(std::string name) : ClapTrap(name + "_clap_name"), ScavTrap(name), FragTrap(name), _name(name) {
+DiamondTrap::DiamondTrap(std::string name) : ClapTrap(name + "_clap_name"), ScavTrap(name), FragTrap(name), _name(name), _nameId(EventLog::UNNAMED) {
 
 	_hitPoints = 100;
 	_energyPoints = 50;
 	_attackDamage = 30;
 
-	std::cout << YELLOW "DiamondTrap " << this->_name << " name constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::DIAMOND_NAMED, this->_name, this->_nameId);
 }
 
-DiamondTrap::DiamondTrap(const DiamondTrap& copyName) {
+DiamondTrap::DiamondTrap(const DiamondTrap& copyName) : ClapTrap(), ScavTrap(), FragTrap(), _nameId(EventLog::UNNAMED) {
 
 	*this = copyName;
 
-	std::cout << GREEN << "DiamondTrap " << this->_name << " copy construtor called" RESET << std::endl;
+	EventLog::emit(EventLog::DIAMOND_COPY, this->_name, this->_nameId);
 }
 
 DiamondTrap::~DiamondTrap() {
-	std::cout << "DiamondTrap " << this->_name << " destructor called" << std::endl;
+	EventLog::emit(EventLog::DIAMOND_DESTROY, this->_name, this->_nameId);
 }
 
 DiamondTrap&	DiamondTrap::operator=(const DiamondTrap& copyName) {
 
-	std::cout << BLUE "Copy assignment operator called" RESET << std::endl;
+	EventLog::emit(EventLog::COPY_ASSIGNMENT, this->_name, this->_nameId);
 
 	if (this != &copyName) {
 		ClapTrap::operator=(copyName); // pour actualiser le nom de la base class egalement
 		this->_name = copyName._name;
+		this->_nameId = copyName._nameId;
 	}
 
 	return (*this);
@@ -47,6 +48,5 @@ void	DiamondTrap::attack(const std::string& target) {
 
 void	DiamondTrap::whoAmI() {
 
-	std::cout << GREEN << "DiamondTrap _name: " << this->_name << std::endl
-			<< "ClapTrap _name: " << ClapTrap::_name << RESET << std::endl;
+	EventLog::emit(EventLog::DIAMOND_WHO_AM_I, this->_name, this->_nameId, ClapTrap::_name);
 }
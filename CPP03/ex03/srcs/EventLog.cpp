@@ -0,0 +1,213 @@
+#include <cstring>
+#include <pthread.h>
+
+#include "ClapTrap.hpp"
+#include "EventLog.hpp"
+
+/*
+ * The text of every kind: %a is the actor, %t the target, %n the amount.
+ * Typos and missing spaces are the ones the classes always printed.
+ */
+static const char*	g_formats[EventLog::EVENT_KINDS] = {
+	YELLOW "Default constructor called" RESET,
+	YELLOW "Constructor by name called" RESET,
+	GREEN "Copy constructor called" RESET,
+	"Destructor called",
+	MAGENTA "ClapTrap %a attacks %t, causing %n points of damage!" RESET,
+	RED "ClapTrap %a cannot attack %t." RESET,
+	MAGENTA "ClapTrap%a took %n of damage!" RESET,
+	MAGENTA "ClapTrap %a took %n of damage, causing them to die!" RESET,
+	MAGENTA "ClapTrap %a repaired for %n of hit points!" RESET,
+	RED "ClapTrap %a cannot repair." RESET,
+	RED "ClapTrap %a cannot have more than %n hit points!" RESET,
+	YELLOW "ScavTrap default constructor called" RESET,
+	YELLOW "ScavTrap %a constructor by name called" RESET,
+	GREEN "%a copy constructor called" RESET,
+	"ScavTrap %a destructor called",
+	MAGENTA "ScavTrap %a attacks %t, causing %n points of damage!" RESET,
+	RED "ScavTrap %a cannot attack %t." RESET,
+	MAGENTA "%a is now in Gate keeper mode." RESET,
+	RED "ScavTrap %a cannot change to Gate keeper mode." RESET,
+	YELLOW "Default FragTrap constructor called" RESET,
+	YELLOW "FragTrap %a name constructor called" RESET,
+	GREEN "%a copy construtor called" RESET,
+	"FragTrap %a destructor called",
+	MAGENTA "FragTrap %a attacks %t, causing %n points of damage!" RESET,
+	RED "FragTrap %a cannot attack %t." RESET,
+	MAGENTA "%a is highfiving the other guys." RESET,
+	RED "FragTrap %a cannot high five." RESET,
+	YELLOW "Default DiamondTrap constructor called" RESET,
+	YELLOW "DiamondTrap %a name constructor called" RESET,
+	GREEN "DiamondTrap %a copy construtor called" RESET,
+	"DiamondTrap %a destructor called",
+	GREEN "DiamondTrap _name: %a\nClapTrap _name: %t" RESET,
+	BLUE "Copy assignment operator called" RESET,
+};
+
+static NameTable		g_names;
+static NameTable		g_longTargets;		// targets over TARGET_SIZE, under g_namesLock too
+static pthread_mutex_t	g_namesLock = PTHREAD_MUTEX_INITIALIZER;
+
+EventLog::e_mode		EventLog::_mode = EventLog::ECHO;
+EventLog::Slot			EventLog::_ring[EventLog::CAPACITY];
+unsigned long			EventLog::_head = 0;
+unsigned long			EventLog::_tail = 0;
+unsigned long			EventLog::_dropped = 0;
+
+
+void	EventLog::setMode(e_mode mode) {
+	_mode = mode;
+}
+
+EventLog::e_mode	EventLog::mode(void) {
+	return (_mode);
+}
+
+size_t	EventLog::dropped(void) {
+	return (__atomic_load_n(&_dropped, __ATOMIC_RELAXED));
+}
+
+std::string	EventLog::name(NameId id) {
+
+	pthread_mutex_lock(&g_namesLock);
+	std::string	name = g_names.get(id);
+	pthread_mutex_unlock(&g_namesLock);
+	return (name);
+}
+
+std::string	EventLog::target(const Event& event) {
+
+	if (event.targetSize != LONG_TARGET)
+		return (std::string(event.target, event.targetSize));
+
+	NameId	id;
+
+	memcpy(&id, event.target, sizeof(id));
+	pthread_mutex_lock(&g_namesLock);
+	std::string	target = g_longTargets.get(id);
+	pthread_mutex_unlock(&g_namesLock);
+	return (target);
+}
+
+
+void	EventLog::emit(e_eventKind kind, const std::string& actor, NameId& actorId, unsigned int amount) {
+
+	static const std::string	noTarget;
+
+	emit(kind, actor, actorId, noTarget, amount);
+}
+
+void	EventLog::emit(e_eventKind kind, const std::string& actor, NameId& actorId,
+	const std::string& target, unsigned int amount) {
+
+	if (_mode == ECHO) {
+		_render(std::cout, kind, actor, target, amount);
+		std::cout << std::endl;
+	}
+	else if (_mode == RECORD)
+		_push(kind, actor, actorId, target, amount);
+}
+
+void	EventLog::_push(e_eventKind kind, const std::string& actor, NameId& actorId,
+	const std::string& target, unsigned int amount) {
+
+	const bool	longTarget = target.size() > static_cast<size_t>(TARGET_SIZE);
+	NameId		targetId = 0;
+
+	if (actorId == UNNAMED || longTarget) {		// once per name and object, or a rare long target
+		pthread_mutex_lock(&g_namesLock);
+		if (actorId == UNNAMED)
+			actorId = g_names.intern(actor);
+		if (longTarget)
+			targetId = g_longTargets.intern(target);
+		pthread_mutex_unlock(&g_namesLock);
+	}
+
+	unsigned long	position = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+	Slot*			slot;
+
+	// claim a position whose slot the consumer has freed for this lap
+	while (true) {
+		slot = &_ring[position & (CAPACITY - 1)];
+
+		const unsigned long	lap = position & ~(unsigned long)(CAPACITY - 1);
+		const long			gap = (long)(__atomic_load_n(&slot->stamp, __ATOMIC_ACQUIRE) - lap);
+
+		if (gap == 0) {
+			if (__atomic_compare_exchange_n(&_tail, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break ;
+		}
+		else if (gap < 0) {		// slot still full from the previous lap
+			__atomic_add_fetch(&_dropped, 1, __ATOMIC_RELAXED);
+			return ;
+		}
+		else
+			position = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+	}
+
+	slot->event.actor = actorId;
+	slot->event.amount = amount;
+	slot->event.kind = kind;
+	if (longTarget) {
+		slot->event.targetSize = LONG_TARGET;
+		memcpy(slot->event.target, &targetId, sizeof(targetId));
+	}
+	else {
+		slot->event.targetSize = target.size();
+		memcpy(slot->event.target, target.data(), target.size());
+	}
+	__atomic_store_n(&slot->stamp, (position & ~(unsigned long)(CAPACITY - 1)) + 1, __ATOMIC_RELEASE);
+}
+
+size_t	EventLog::drain(Consumer consumer) {
+
+	size_t	consumed = 0;
+
+	while (true) {
+		Slot&				slot = _ring[_head & (CAPACITY - 1)];
+		const unsigned long	lap = _head & ~(unsigned long)(CAPACITY - 1);
+
+		if (__atomic_load_n(&slot.stamp, __ATOMIC_ACQUIRE) != lap + 1)
+			break ;
+
+		const Event	event = slot.event;
+
+		__atomic_store_n(&slot.stamp, lap + CAPACITY, __ATOMIC_RELEASE);
+		_head++;
+		consumer(event);
+		consumed++;
+	}
+	return (consumed);
+}
+
+
+void	EventLog::_render(std::ostream& out, unsigned int kind, const std::string& actor,
+	const std::string& target, unsigned int amount) {
+
+	const char*	format = g_formats[kind];
+	const char*	start = format;
+
+	for (; *format; format++) {
+		if (*format != '%')
+			continue ;
+		out.write(start, format - start);
+		format++;
+		if (*format == 'a')
+			out << actor;
+		else if (*format == 't')
+			out << target;
+		else
+			out << amount;
+		start = format + 1;
+	}
+	out.write(start, format - start);
+}
+
+void	EventLog::render(std::ostream& out, const Event& event) {
+	_render(out, event.kind, name(event.actor), target(event), event.amount);
+}
+
+void	EventLog::print(const Event& event) {
+	render(std::cout, event);
+	std::cout << std::endl;
+}
@@ -6,7 +6,7 @@ FragTrap::FragTrap(void) : ClapTrap() {
 	this->_energyPoints = 100;
 	this->_attackDamage = 30;
 
-	std::cout << YELLOW "Default FragTrap constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::FRAG_DEFAULT, this->_name, this->_nameId);
 }
 
 FragTrap::FragTrap(std::string name) : ClapTrap(name) {
@@ -15,26 +15,27 @@ FragTrap::FragTrap(std::string name) : ClapTrap(name) {
 	this->_energyPoints = 100;
 	this->_attackDamage = 30;
 
-	std::cout << YELLOW "FragTrap " << this->_name << " name constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::FRAG_NAMED, this->_name, this->_nameId);
 }
 
 FragTrap::FragTrap(const FragTrap& copyName) : ClapTrap(copyName) {
 
 	*this = copyName;
 
-	std::cout << GREEN << this->_name << " copy construtor called" RESET << std::endl;
+	EventLog::emit(EventLog::FRAG_COPY, this->_name, this->_nameId);
 }
 
 FragTrap::~FragTrap(void) {
-	std::cout << "FragTrap " << this->_name << " destructor called" << std::endl;
+	EventLog::emit(EventLog::FRAG_DESTROY, this->_name, this->_nameId);
 }
 
 FragTrap&	FragTrap::operator=(const FragTrap& copyName) {
 
-	std::cout << BLUE "Copy assignment operator called" RESET << std::endl;
+	EventLog::emit(EventLog::COPY_ASSIGNMENT, this->_name, this->_nameId);
 
 	if (this != &copyName) {
 		this->_name = copyName._name;
+		this->_nameId = copyName._nameId;
 		this->_hitPoints = copyName._hitPoints;
 		this->_energyPoints = copyName._energyPoints;
 		this->_attackDamage = copyName._attackDamage;
@@ -47,20 +48,20 @@ FragTrap&	FragTrap::operator=(const FragTrap& copyName) {
 void	FragTrap::attack(const std::string& target) {
 
 	if (_energyPoints == 0 || _hitPoints == 0) {
-		std::cout << RED "FragTrap " << _name << " cannot attack " << target << "." RESET << std::endl;
+		EventLog::emit(EventLog::FRAG_CANNOT_ATTACK, _name, _nameId, target);
 		return ;
 	}
 
 	_energyPoints--;
-	std::cout << MAGENTA "FragTrap " << _name << " attacks " << target << ", causing " << _attackDamage << " points of damage!" RESET << std::endl;
+	EventLog::emit(EventLog::FRAG_ATTACK, _name, _nameId, target, _attackDamage);
 }
 
 void	FragTrap::highFivesGuys(void) {
 	if (_energyPoints == 0 || _hitPoints == 0) {
-		std::cout << RED "FragTrap " << _name << " cannot high five." RESET << std::endl;
+		EventLog::emit(EventLog::FRAG_CANNOT_HIGH_FIVE, _name, _nameId);
 		return ;
 	}
 
 	_energyPoints--;
-	std::cout << MAGENTA << _name << " is highfiving the other guys." RESET << std::endl;
+	EventLog::emit(EventLog::FRAG_HIGH_FIVES, _name, _nameId);
 }
@@ -0,0 +1,44 @@
+#include "NameTable.hpp"
+
+NameTable::NameTable(void) {}
+
+NameTable::NameTable(const NameTable& copyName) : _names(copyName._names), _ids(copyName._ids) {}
+
+NameTable::~NameTable(void) {}
+
+NameTable&	NameTable::operator=(const NameTable& copyName) {
+
+	if (this != &copyName) {
+		this->_names = copyName._names;
+		this->_ids = copyName._ids;
+	}
+
+	return (*this);
+}
+
+NameId	NameTable::intern(const std::string& name) {
+
+	std::map<std::string, NameId>::iterator	it = this->_ids.find(name);
+
+	if (it != this->_ids.end())
+		return (it->second);
+
+	NameId	id = this->_names.size();
+
+	this->_names.push_back(name);
+	this->_ids[name] = id;
+	return (id);
+}
+
+const std::string&	NameTable::get(NameId id) const {
+	return (this->_names[id]);
+}
+
+size_t	NameTable::size(void) const {
+	return (this->_names.size());
+}
+
+void	NameTable::clear(void) {
+	this->_names.clear();
+	this->_ids.clear();
+}
@@ -8,7 +8,7 @@ ScavTrap::ScavTrap(void) : ClapTrap() {
 	this->_energyPoints = 50;
 	this->_attackDamage = 20;
 
-	std::cout << YELLOW "ScavTrap default constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::SCAV_DEFAULT, this->_name, this->_nameId);
 }
 
 ScavTrap::ScavTrap(std::string name) : ClapTrap(name) {
@@ -17,49 +17,50 @@ ScavTrap::ScavTrap(std::string name) : ClapTrap(name) {
 	this->_energyPoints = 50;
 	this->_attackDamage = 20;
 
-	std::cout << YELLOW "ScavTrap " << this->_name <<" constructor by name called" RESET << std::endl;
+	EventLog::emit(EventLog::SCAV_NAMED, this->_name, this->_nameId);
 }
 
 ScavTrap::ScavTrap(const ScavTrap& copyName) : ClapTrap(copyName) {
 
 	*this = copyName;
 
-	std::cout << GREEN << this->_name << " copy constructor called" RESET << std::endl;
+	EventLog::emit(EventLog::SCAV_COPY, this->_name, this->_nameId);
 }
 
 ScavTrap::~ScavTrap(void) {
-	std::cout << "ScavTrap " << this->_name << " destructor called" << std::endl;
+	EventLog::emit(EventLog::SCAV_DESTROY, this->_name, this->_nameId);
 }
 
 void	ScavTrap::guardGate(void) {
 
 	if (_energyPoints == 0 || _hitPoints == 0) {
-		std::cout << RED "ScavTrap " << _name << " cannot change to Gate keeper mode." RESET << std::endl;
+		EventLog::emit(EventLog::SCAV_CANNOT_GUARD_GATE, _name, _nameId);
 		return ;
 	}
 
 	_energyPoints--;
-	std::cout << MAGENTA << this->_name << " is now in Gate keeper mode." RESET << std::endl;
+	EventLog::emit(EventLog::SCAV_GUARD_GATE, this->_name, this->_nameId);
 }
 
 void	ScavTrap::attack(const std::string& target) {
 
 	if (_energyPoints == 0 || _hitPoints == 0) {
-		std::cout << RED "ScavTrap " << _name << " cannot attack " << target << "." RESET << std::endl;
+		EventLog::emit(EventLog::SCAV_CANNOT_ATTACK, _name, _nameId, target);
 		return ;
 	}
 
 	_energyPoints--;
-	std::cout << MAGENTA "ScavTrap " << _name << " attacks " << target << ", causing " << _attackDamage << " points of damage!" RESET << std::endl;
+	EventLog::emit(EventLog::SCAV_ATTACK, _name, _nameId, target, _attackDamage);
 }
 
 
 ScavTrap&	ScavTrap::operator=(const ScavTrap& copyName) {
 
-	std::cout << BLUE "Copy assignment operator called" RESET << std::endl;
+	EventLog::emit(EventLog::COPY_ASSIGNMENT, this->_name, this->_nameId);
 
 	if (this != &copyName) {
 		this->_name = copyName._name;
+		this->_nameId = copyName._nameId;
 		this->_hitPoints = copyName._hitPoints;
 		this->_energyPoints = copyName._energyPoints;
 		this->_attackDamage = copyName._attackDamage;
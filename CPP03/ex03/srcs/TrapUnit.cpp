@@ -0,0 +1,167 @@
+#include <climits>
+
+#include "ClapTrap.hpp"
+#include "TrapUnit.hpp"
+
+struct AttackEvents {
+	EventLog::e_eventKind	done;
+	EventLog::e_eventKind	refused;
+};
+
+/* The attack() each class ends up calling, indexed by e_unitKind */
+static const AttackEvents	g_attackEvents[] = {
+	{EventLog::CLAP_ATTACK, EventLog::CLAP_CANNOT_ATTACK},
+	{EventLog::SCAV_ATTACK, EventLog::SCAV_CANNOT_ATTACK},
+	{EventLog::FRAG_ATTACK, EventLog::FRAG_CANNOT_ATTACK},
+	{EventLog::SCAV_ATTACK, EventLog::SCAV_CANNOT_ATTACK},
+};
+
+TrapUnit::TrapUnit(void) : _name("Dumb"), _nameId(EventLog::UNNAMED), _diamondNameId(EventLog::UNNAMED) {
+	this->_spawn(UNIT_CLAPTRAP);
+}
+
+TrapUnit::TrapUnit(e_unitKind kind)
+	: _name(kind == UNIT_DIAMONDTRAP ? "unknown_clap_name" : "Dumb"), _nameId(EventLog::UNNAMED), _diamondNameId(EventLog::UNNAMED) {
+
+	this->_spawn(kind);
+	if (kind == UNIT_DIAMONDTRAP)
+		this->_diamondName = "Diamond";
+}
+
+TrapUnit::TrapUnit(e_unitKind kind, const std::string& name)
+	: _name(name), _nameId(EventLog::UNNAMED), _diamondNameId(EventLog::UNNAMED) {
+
+	this->_spawn(kind);
+	if (kind == UNIT_DIAMONDTRAP) {
+		this->_name += "_clap_name";
+		this->_diamondName = name;
+	}
+}
+
+TrapUnit::TrapUnit(const TrapUnit& copyName)
+	: _name(copyName._name), _diamondName(copyName._diamondName), _nameId(copyName._nameId),
+	_diamondNameId(copyName._diamondNameId), _hitPoints(copyName._hitPoints),
+	_energyPoints(copyName._energyPoints), _attackDamage(copyName._attackDamage), _kind(copyName._kind) {}
+
+TrapUnit::~TrapUnit(void) {}
+
+TrapUnit&	TrapUnit::operator=(const TrapUnit& copyName) {
+
+	if (this != &copyName) {
+		this->_name = copyName._name;
+		this->_diamondName = copyName._diamondName;
+		this->_nameId = copyName._nameId;
+		this->_diamondNameId = copyName._diamondNameId;
+		this->_hitPoints = copyName._hitPoints;
+		this->_energyPoints = copyName._energyPoints;
+		this->_attackDamage = copyName._attackDamage;
+		this->_kind = copyName._kind;
+	}
+
+	return (*this);
+}
+
+void	TrapUnit::_spawn(e_unitKind kind) {
+
+	const UnitStats&	stats = UnitArena::spawnStats(kind);
+
+	this->_kind = kind;
+	this->_hitPoints = stats.hitPoints;
+	this->_energyPoints = stats.energyPoints;
+	this->_attackDamage = stats.attackDamage;
+}
+
+
+e_unitKind	TrapUnit::kind(void) const {
+	return (this->_kind);
+}
+
+const std::string&	TrapUnit::name(void) const {
+	return (this->_name);
+}
+
+unsigned int	TrapUnit::hitPoints(void) const {
+	return (this->_hitPoints);
+}
+
+unsigned int	TrapUnit::energyPoints(void) const {
+	return (this->_energyPoints);
+}
+
+unsigned int	TrapUnit::attackDamage(void) const {
+	return (this->_attackDamage);
+}
+
+
+void	TrapUnit::attack(const std::string& target) {
+
+	const AttackEvents&	events = g_attackEvents[this->_kind];
+
+	if (this->_energyPoints == 0 || this->_hitPoints == 0) {
+		EventLog::emit(events.refused, this->_name, this->_nameId, target);
+		return ;
+	}
+	this->_energyPoints--;
+	EventLog::emit(events.done, this->_name, this->_nameId, target, this->_attackDamage);
+}
+
+void	TrapUnit::takeDamage(unsigned int amount) {
+
+	if (amount >= this->_hitPoints) {
+		this->_hitPoints = 0;
+		EventLog::emit(EventLog::CLAP_DEATH, this->_name, this->_nameId, amount);
+		return ;
+	}
+	this->_hitPoints -= amount;
+	EventLog::emit(EventLog::CLAP_DAMAGE, this->_name, this->_nameId, amount);
+}
+
+void	TrapUnit::beRepaired(unsigned int amount) {
+
+	if (this->_energyPoints == 0 || this->_hitPoints == 0) {
+		EventLog::emit(EventLog::CLAP_CANNOT_REPAIR, this->_name, this->_nameId);
+		return ;
+	}
+	if ((UINT_MAX - amount) < this->_hitPoints) {
+		EventLog::emit(EventLog::CLAP_REPAIR_OVERFLOW, this->_name, this->_nameId, UINT_MAX);
+		return ;
+	}
+	this->_energyPoints--;
+	this->_hitPoints += amount;
+	EventLog::emit(EventLog::CLAP_REPAIR, this->_name, this->_nameId, amount);
+}
+
+void	TrapUnit::guardGate(void) {
+
+	if (this->_kind != UNIT_SCAVTRAP && this->_kind != UNIT_DIAMONDTRAP)
+		return ;
+	if (this->_energyPoints == 0 || this->_hitPoints == 0) {
+		EventLog::emit(EventLog::SCAV_CANNOT_GUARD_GATE, this->_name, this->_nameId);
+		return ;
+	}
+	this->_energyPoints--;
+	EventLog::emit(EventLog::SCAV_GUARD_GATE, this->_name, this->_nameId);
+}
+
+void	TrapUnit::highFivesGuys(void) {
+
+	if (this->_kind != UNIT_FRAGTRAP && this->_kind != UNIT_DIAMONDTRAP)
+		return ;
+	if (this->_energyPoints == 0 || this->_hitPoints == 0) {
+		EventLog::emit(EventLog::FRAG_CANNOT_HIGH_FIVE, this->_name, this->_nameId);
+		return ;
+	}
+	this->_energyPoints--;
+	EventLog::emit(EventLog::FRAG_HIGH_FIVES, this->_name, this->_nameId);
+}
+
+void	TrapUnit::whoAmI(void) {
+
+	if (this->_kind == UNIT_DIAMONDTRAP)
+		EventLog::emit(EventLog::DIAMOND_WHO_AM_I, this->_diamondName, this->_diamondNameId, this->_name);
+}
+
+
+void	TrapUnit::clapTrapState(void) const {
+	std::cout << "\n" BLUE << this->_name << " has:" << "\n" << this->_hitPoints << " hit points" << "\n" << this->_energyPoints << " energy points and " << "\n" << this->_attackDamage << " attack damage!" << RESET << std::endl;
+}
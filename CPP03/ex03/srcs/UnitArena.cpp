@@ -0,0 +1,275 @@
+#include <climits>
+#include <iostream>
+#if defined(__SSE2__)
+# include <immintrin.h>
+#endif
+
+#include "ClapTrap.hpp"
+#include "UnitArena.hpp"
+
+/* Same values as the constructors, indexed by e_unitKind */
+static const UnitStats	g_spawnStats[] = {
+	{"ClapTrap", 10, 10, 0},
+	{"ScavTrap", 100, 50, 20},
+	{"FragTrap", 100, 100, 30},
+	{"DiamondTrap", 100, 50, 30},
+};
+
+UnitArena::UnitArena(void) {}
+
+UnitArena::UnitArena(const UnitArena& copyName)
+	: _hitPoints(copyName._hitPoints), _energyPoints(copyName._energyPoints), _attackDamage(copyName._attackDamage),
+	_kind(copyName._kind), _name(copyName._name), _names(copyName._names) {}
+
+UnitArena::~UnitArena(void) {}
+
+UnitArena&	UnitArena::operator=(const UnitArena& copyName) {
+
+	if (this != &copyName) {
+		this->_hitPoints = copyName._hitPoints;
+		this->_energyPoints = copyName._energyPoints;
+		this->_attackDamage = copyName._attackDamage;
+		this->_kind = copyName._kind;
+		this->_name = copyName._name;
+		this->_names = copyName._names;
+	}
+
+	return (*this);
+}
+
+
+UnitId	UnitArena::spawn(e_unitKind kind, const std::string& name) {
+	return (this->spawn(kind, name, 1));
+}
+
+UnitId	UnitArena::spawn(e_unitKind kind, const std::string& name, size_t count) {
+
+	const UnitId		first = this->_kind.size();
+	const UnitStats&	stats = g_spawnStats[kind];
+	const size_t		size = first + count;
+
+	this->_hitPoints.resize(size, stats.hitPoints);
+	this->_energyPoints.resize(size, stats.energyPoints);
+	this->_attackDamage.resize(size, stats.attackDamage);
+	this->_kind.resize(size, (unsigned char)kind);
+	this->_name.resize(size, this->_names.intern(name));
+	return (first);
+}
+
+size_t	UnitArena::size(void) const {
+	return (this->_kind.size());
+}
+
+void	UnitArena::reserve(size_t capacity) {
+	this->_hitPoints.reserve(capacity);
+	this->_energyPoints.reserve(capacity);
+	this->_attackDamage.reserve(capacity);
+	this->_kind.reserve(capacity);
+	this->_name.reserve(capacity);
+}
+
+void	UnitArena::clear(void) {
+	this->_hitPoints.clear();
+	this->_energyPoints.clear();
+	this->_attackDamage.clear();
+	this->_kind.clear();
+	this->_name.clear();
+	this->_names.clear();
+}
+
+
+e_unitKind	UnitArena::kind(UnitId unit) const {
+	return ((e_unitKind)this->_kind[unit]);
+}
+
+const std::string&	UnitArena::name(UnitId unit) const {
+	return (this->_names.get(this->_name[unit]));
+}
+
+std::string	UnitArena::clapName(UnitId unit) const {
+
+	if (this->kind(unit) == UNIT_DIAMONDTRAP)
+		return (this->name(unit) + "_clap_name");
+	return (this->name(unit));
+}
+
+unsigned int	UnitArena::hitPoints(UnitId unit) const {
+	return (this->_hitPoints[unit]);
+}
+
+unsigned int	UnitArena::energyPoints(UnitId unit) const {
+	return (this->_energyPoints[unit]);
+}
+
+unsigned int	UnitArena::attackDamage(UnitId unit) const {
+	return (this->_attackDamage[unit]);
+}
+
+bool	UnitArena::alive(UnitId unit) const {
+	return (this->_hitPoints[unit] != 0);
+}
+
+unsigned int*	UnitArena::hitPointsData(void) {
+	return (this->_hitPoints.empty() ? NULL : &this->_hitPoints[0]);
+}
+
+unsigned int*	UnitArena::energyPointsData(void) {
+	return (this->_energyPoints.empty() ? NULL : &this->_energyPoints[0]);
+}
+
+unsigned int*	UnitArena::attackDamageData(void) {
+	return (this->_attackDamage.empty() ? NULL : &this->_attackDamage[0]);
+}
+
+
+bool	UnitArena::attack(UnitId unit) {
+
+	if (this->_energyPoints[unit] == 0 || this->_hitPoints[unit] == 0)
+		return (false);
+	this->_energyPoints[unit]--;
+	return (true);
+}
+
+bool	UnitArena::strike(UnitId attacker, UnitId target) {
+
+	if (!this->attack(attacker))
+		return (false);
+	this->takeDamage(target, this->_attackDamage[attacker]);
+	return (true);
+}
+
+void	UnitArena::takeDamage(UnitId unit, unsigned int amount) {
+
+	if (amount >= this->_hitPoints[unit])
+		this->_hitPoints[unit] = 0;
+	else
+		this->_hitPoints[unit] -= amount;
+}
+
+bool	UnitArena::beRepaired(UnitId unit, unsigned int amount) {
+
+	if (this->_energyPoints[unit] == 0 || this->_hitPoints[unit] == 0)
+		return (false);
+	if ((UINT_MAX - amount) < this->_hitPoints[unit])
+		return (false);
+	this->_energyPoints[unit]--;
+	this->_hitPoints[unit] += amount;
+	return (true);
+}
+
+/*
+ * No unsigned compare before AVX-512: flipping the sign bit of both sides
+ * turns the signed one into it. hitPoints - amount clamped at 0 is then
+ * (hitPoints > amount ? hitPoints - amount : 0), and hitPoints + amount
+ * overflows (the UINT_MAX guard) exactly when the sum is below hitPoints.
+ */
+void	UnitArena::takeDamage(UnitId first, size_t count, const unsigned int* amounts) {
+
+	size_t			i = 0;
+
+#if defined(__SSE2__)
+	unsigned int*	hitPoints = this->hitPointsData() + first;
+#endif
+#if defined(__AVX2__)
+	const __m256i	bias = _mm256_set1_epi32(INT_MIN);
+
+	for (; i + 8 <= count; i += 8) {
+		const __m256i	hp = _mm256_loadu_si256((const __m256i*)(hitPoints + i));
+		const __m256i	amount = _mm256_loadu_si256((const __m256i*)(amounts + i));
+		const __m256i	above = _mm256_cmpgt_epi32(_mm256_xor_si256(hp, bias), _mm256_xor_si256(amount, bias));
+
+		_mm256_storeu_si256((__m256i*)(hitPoints + i), _mm256_and_si256(_mm256_sub_epi32(hp, amount), above));
+	}
+#elif defined(__SSE2__)
+	const __m128i	bias = _mm_set1_epi32(INT_MIN);
+
+	for (; i + 4 <= count; i += 4) {
+		const __m128i	hp = _mm_loadu_si128((const __m128i*)(hitPoints + i));
+		const __m128i	amount = _mm_loadu_si128((const __m128i*)(amounts + i));
+		const __m128i	above = _mm_cmpgt_epi32(_mm_xor_si128(hp, bias), _mm_xor_si128(amount, bias));
+
+		_mm_storeu_si128((__m128i*)(hitPoints + i), _mm_and_si128(_mm_sub_epi32(hp, amount), above));
+	}
+#endif
+	for (; i < count; i++)
+		this->takeDamage(first + i, amounts[i]);
+}
+
+size_t	UnitArena::beRepaired(UnitId first, size_t count, const unsigned int* amounts) {
+
+	size_t			repaired = 0;
+	size_t			i = 0;
+
+#if defined(__SSE2__)
+	unsigned int*	hitPoints = this->hitPointsData() + first;
+	unsigned int*	energyPoints = this->energyPointsData() + first;
+#endif
+#if defined(__AVX2__)
+	const __m256i	bias = _mm256_set1_epi32(INT_MIN);
+	const __m256i	zero = _mm256_setzero_si256();
+
+	for (; i + 8 <= count; i += 8) {
+		const __m256i	hp = _mm256_loadu_si256((const __m256i*)(hitPoints + i));
+		const __m256i	ep = _mm256_loadu_si256((const __m256i*)(energyPoints + i));
+		const __m256i	amount = _mm256_loadu_si256((const __m256i*)(amounts + i));
+		const __m256i	sum = _mm256_add_epi32(hp, amount);
+		const __m256i	refused = _mm256_or_si256(
+			_mm256_cmpgt_epi32(_mm256_xor_si256(hp, bias), _mm256_xor_si256(sum, bias)),
+			_mm256_or_si256(_mm256_cmpeq_epi32(hp, zero), _mm256_cmpeq_epi32(ep, zero)));
+		const __m256i	done = _mm256_andnot_si256(refused, _mm256_cmpeq_epi32(zero, zero));
+
+		_mm256_storeu_si256((__m256i*)(hitPoints + i), _mm256_add_epi32(hp, _mm256_and_si256(amount, done)));
+		_mm256_storeu_si256((__m256i*)(energyPoints + i), _mm256_add_epi32(ep, done));		// done lanes are -1
+		repaired += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(done)));
+	}
+#elif defined(__SSE2__)
+	const __m128i	bias = _mm_set1_epi32(INT_MIN);
+	const __m128i	zero = _mm_setzero_si128();
+
+	for (; i + 4 <= count; i += 4) {
+		const __m128i	hp = _mm_loadu_si128((const __m128i*)(hitPoints + i));
+		const __m128i	ep = _mm_loadu_si128((const __m128i*)(energyPoints + i));
+		const __m128i	amount = _mm_loadu_si128((const __m128i*)(amounts + i));
+		const __m128i	sum = _mm_add_epi32(hp, amount);
+		const __m128i	refused = _mm_or_si128(
+			_mm_cmpgt_epi32(_mm_xor_si128(hp, bias), _mm_xor_si128(sum, bias)),
+			_mm_or_si128(_mm_cmpeq_epi32(hp, zero), _mm_cmpeq_epi32(ep, zero)));
+		const __m128i	done = _mm_andnot_si128(refused, _mm_cmpeq_epi32(zero, zero));
+
+		_mm_storeu_si128((__m128i*)(hitPoints + i), _mm_add_epi32(hp, _mm_and_si128(amount, done)));
+		_mm_storeu_si128((__m128i*)(energyPoints + i), _mm_add_epi32(ep, done));
+		repaired += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(done)));
+	}
+#endif
+	for (; i < count; i++)
+		repaired += this->beRepaired(first + i, amounts[i]);
+	return (repaired);
+}
+
+bool	UnitArena::guardGate(UnitId unit) {
+
+	if (this->kind(unit) != UNIT_SCAVTRAP && this->kind(unit) != UNIT_DIAMONDTRAP)
+		return (false);
+	return (this->attack(unit));
+}
+
+bool	UnitArena::highFivesGuys(UnitId unit) {
+
+	if (this->kind(unit) != UNIT_FRAGTRAP && this->kind(unit) != UNIT_DIAMONDTRAP)
+		return (false);
+	return (this->attack(unit));
+}
+
+
+void	UnitArena::unitState(UnitId unit) const {
+	std::cout << "\n" BLUE << this->clapName(unit) << " has:" << "\n" << this->_hitPoints[unit] << " hit points" << "\n"
+		<< this->_energyPoints[unit] << " energy points and " << "\n" << this->_attackDamage[unit] << " attack damage!" << RESET << std::endl;
+}
+
+const char*	UnitArena::kindName(e_unitKind kind) {
+	return (g_spawnStats[kind].name);
+}
+
+const UnitStats&	UnitArena::spawnStats(e_unitKind kind) {
+	return (g_spawnStats[kind]);
+}
@@ -0,0 +1,253 @@
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "UnitSnapshot.hpp"
+
+struct SnapshotLayout {
+	size_t	hitPoints;
+	size_t	energyPoints;
+	size_t	attackDamage;
+	size_t	name;
+	size_t	kind;
+	size_t	nameEnd;
+	size_t	text;
+	size_t	total;
+};
+
+static size_t	align8(size_t offset) {
+	return ((offset + 7) & ~(size_t)7);
+}
+
+/* Section offsets for these counts, see UnitSnapshot.hpp */
+static SnapshotLayout	layout(size_t units, size_t names, size_t textSize) {
+
+	SnapshotLayout	at;
+
+	at.hitPoints = align8(sizeof(SnapshotHeader));
+	at.energyPoints = align8(at.hitPoints + units * sizeof(unsigned int));
+	at.attackDamage = align8(at.energyPoints + units * sizeof(unsigned int));
+	at.name = align8(at.attackDamage + units * sizeof(unsigned int));
+	at.kind = align8(at.name + units * sizeof(NameId));
+	at.nameEnd = align8(at.kind + units);
+	at.text = at.nameEnd + names * sizeof(uint64_t);
+	at.total = at.text + textSize;
+	return (at);
+}
+
+static bool	writeAll(int fd, const void* data, size_t size) {
+
+	const char*	bytes = static_cast<const char*>(data);
+
+	while (size > 0) {
+		const ssize_t	written = write(fd, bytes, size);
+
+		if (written < 0)
+			return (false);
+		bytes += written;
+		size -= written;
+	}
+	return (true);
+}
+
+/* data, then zeros up to offset `end` of the file */
+static bool	writeSection(int fd, const void* data, size_t size, size_t& offset, size_t end) {
+
+	static const char	zeros[8] = {0};
+
+	if (size > 0 && !writeAll(fd, data, size))
+		return (false);
+	offset += size;
+	if (!writeAll(fd, zeros, end - offset))
+		return (false);
+	offset = end;
+	return (true);
+}
+
+/* fsync the directory holding path, so that a rename into it is on disk too */
+static bool	syncDirectory(const std::string& path) {
+
+	const size_t		slash = path.rfind('/');
+	const std::string	directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+	const int			fd = open(directory.c_str(), O_RDONLY);
+	bool				synced;
+
+	if (fd < 0)
+		return (false);
+	synced = fsync(fd) == 0;
+	close(fd);
+	return (synced);
+}
+
+
+UnitSnapshot::UnitSnapshot(const std::string& path)
+	: _map(NULL), _mapSize(0), _header(NULL), _hitPoints(NULL), _energyPoints(NULL), _attackDamage(NULL),
+	_name(NULL), _kind(NULL), _nameEnd(NULL), _text(NULL) {
+
+	const int	fd = open(path.c_str(), O_RDONLY);
+	struct stat	info;
+
+	if (fd < 0)
+		return ;
+	if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(SnapshotHeader)) {
+		this->_map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (this->_map == MAP_FAILED)
+			this->_map = NULL;
+		else
+			this->_mapSize = info.st_size;
+	}
+	close(fd);
+	if (this->_map == NULL)
+		return ;
+
+	const SnapshotHeader*	header = static_cast<const SnapshotHeader*>(this->_map);
+	const size_t			limit = this->_mapSize;
+
+	// counts bounded by the file size first, so that layout() cannot overflow
+	if (memcmp(header->magic, SNAPSHOT_MAGIC, 8) != 0 || header->reserved != 0 || header->units > limit / 17
+		|| header->names > limit / 8 || header->textSize > limit)
+		return ;
+
+	const SnapshotLayout	at = layout(header->units, header->names, header->textSize);
+	const char*				base = static_cast<const char*>(this->_map);
+
+	if (at.total != limit)
+		return ;
+	this->_nameEnd = reinterpret_cast<const uint64_t*>(base + at.nameEnd);
+	for (size_t i = 0; i < header->names; i++)
+		if (this->_nameEnd[i] > header->textSize || (i > 0 && this->_nameEnd[i] < this->_nameEnd[i - 1]))
+			return ;
+	this->_header = header;
+	this->_hitPoints = reinterpret_cast<const unsigned int*>(base + at.hitPoints);
+	this->_energyPoints = reinterpret_cast<const unsigned int*>(base + at.energyPoints);
+	this->_attackDamage = reinterpret_cast<const unsigned int*>(base + at.attackDamage);
+	this->_name = reinterpret_cast<const NameId*>(base + at.name);
+	this->_kind = reinterpret_cast<const unsigned char*>(base + at.kind);
+	this->_text = base + at.text;
+}
+
+UnitSnapshot::~UnitSnapshot(void) {
+	if (this->_map != NULL)
+		munmap(this->_map, this->_mapSize);
+}
+
+
+bool	UnitSnapshot::isOpen(void) const {
+	return (this->_header != NULL);
+}
+
+size_t	UnitSnapshot::size(void) const {
+	return (this->_header ? this->_header->units : 0);
+}
+
+size_t	UnitSnapshot::nameCount(void) const {
+	return (this->_header ? this->_header->names : 0);
+}
+
+unsigned int	UnitSnapshot::tick(void) const {
+	return (this->_header ? this->_header->tick : 0);
+}
+
+const unsigned int*	UnitSnapshot::hitPoints(void) const {
+	return (this->_hitPoints);
+}
+
+const unsigned int*	UnitSnapshot::energyPoints(void) const {
+	return (this->_energyPoints);
+}
+
+const unsigned int*	UnitSnapshot::attackDamage(void) const {
+	return (this->_attackDamage);
+}
+
+const NameId*	UnitSnapshot::nameIds(void) const {
+	return (this->_name);
+}
+
+const unsigned char*	UnitSnapshot::kinds(void) const {
+	return (this->_kind);
+}
+
+std::string	UnitSnapshot::name(NameId id) const {
+
+	const uint64_t	start = id > 0 ? this->_nameEnd[id - 1] : 0;
+
+	return (std::string(this->_text + start, this->_nameEnd[id] - start));
+}
+
+
+bool	UnitSnapshot::restore(UnitArena& arena) const {
+
+	const size_t	units = this->size();
+	const size_t	names = this->nameCount();
+
+	if (!this->isOpen())
+		return (false);
+	for (size_t i = 0; i < units; i++)
+		if (this->_kind[i] > UNIT_DIAMONDTRAP || this->_name[i] >= names)
+			return (false);
+
+	NameTable	table;
+
+	for (size_t id = 0; id < names; id++)
+		if (table.intern(this->name(id)) != id)		// a name stored twice
+			return (false);
+	arena._hitPoints.assign(this->_hitPoints, this->_hitPoints + units);
+	arena._energyPoints.assign(this->_energyPoints, this->_energyPoints + units);
+	arena._attackDamage.assign(this->_attackDamage, this->_attackDamage + units);
+	arena._kind.assign(this->_kind, this->_kind + units);
+	arena._name.assign(this->_name, this->_name + units);
+	arena._names = table;
+	return (true);
+}
+
+bool	UnitSnapshot::save(const UnitArena& arena, const std::string& path, unsigned int tick) {
+
+	const size_t			units = arena.size();
+	const size_t			names = arena._names.size();
+	std::vector<uint64_t>	nameEnd(names);
+	std::string				text;
+
+	for (size_t id = 0; id < names; id++) {
+		text += arena._names.get(id);
+		nameEnd[id] = text.size();
+	}
+
+	const SnapshotLayout	at = layout(units, names, text.size());
+	SnapshotHeader			header;
+	size_t					offset = 0;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, SNAPSHOT_MAGIC, 8);
+	header.units = units;
+	header.names = names;
+	header.textSize = text.size();
+	header.tick = tick;
+
+	const std::string	partial = path + ".part";
+	const int			fd = open(partial.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+	if (fd < 0)
+		return (false);
+
+	// written aside, flushed, then renamed: a crash mid-save keeps the
+	// previous snapshot, never a renamed file whose data is not on disk yet
+	const bool	written = writeSection(fd, &header, sizeof(header), offset, at.hitPoints)
+		&& writeSection(fd, units ? &arena._hitPoints[0] : NULL, units * sizeof(unsigned int), offset, at.energyPoints)
+		&& writeSection(fd, units ? &arena._energyPoints[0] : NULL, units * sizeof(unsigned int), offset, at.attackDamage)
+		&& writeSection(fd, units ? &arena._attackDamage[0] : NULL, units * sizeof(unsigned int), offset, at.name)
+		&& writeSection(fd, units ? &arena._name[0] : NULL, units * sizeof(NameId), offset, at.kind)
+		&& writeSection(fd, units ? &arena._kind[0] : NULL, units, offset, at.nameEnd)
+		&& writeSection(fd, names ? &nameEnd[0] : NULL, names * sizeof(uint64_t), offset, at.text)
+		&& writeSection(fd, text.data(), text.size(), offset, at.total)
+		&& fsync(fd) == 0;
+
+	if (close(fd) != 0 || !written || rename(partial.c_str(), path.c_str()) != 0) {
+		unlink(partial.c_str());
+		return (false);
+	}
+	return (syncDirectory(path));
+}
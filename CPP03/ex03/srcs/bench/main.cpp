@@ -0,0 +1,197 @@
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+#include "DiamondTrap.hpp"
+#include "TrapUnit.hpp"
+
+/*
+ * ./trapBench: the same silent brawl on the class hierarchy (ClapTrap*
+ * and virtual attack, stats behind the vbase pointer) and on TrapUnit
+ * (tagged union, no virtual dispatch). Populations are rebuilt between
+ * repetitions, outside of the timed part.
+ */
+
+enum { UNITS = 4096, ROUNDS = 20, REPETITIONS = 50 };
+
+static uint64_t	nowNs(void) {
+
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+static void	report(const char* name, uint64_t ns, size_t ops) {
+
+	const double	perOp = ops ? (double)ns / ops : 0.0;
+
+	std::cout << "  " << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << perOp << " ns/op" << std::setw(12) << (perOp > 0 ? 1000.0 / perOp : 0.0) << " Mop/s" << std::endl;
+}
+
+static ClapTrap*	newTrap(int kind) {
+
+	if (kind == UNIT_SCAVTRAP)
+		return (new ScavTrap("Scav"));
+	if (kind == UNIT_FRAGTRAP)
+		return (new FragTrap("Frag"));
+	if (kind == UNIT_DIAMONDTRAP)
+		return (new DiamondTrap("Diamond"));
+	return (new ClapTrap("Clap"));
+}
+
+/* attack, takeDamage and beRepaired through ClapTrap*, every kind mixed */
+static void	brawlVirtual(const std::string& target) {
+
+	uint64_t	elapsed = 0;
+
+	for (int rep = 0; rep < REPETITIONS; rep++) {
+		std::vector<ClapTrap*>	units;
+
+		for (int i = 0; i < UNITS; i++)
+			units.push_back(newTrap(i & 3));
+
+		const uint64_t	start = nowNs();
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (int i = 0; i < UNITS; i++) {
+				units[i]->attack(target);
+				units[(i * 7 + round) % UNITS]->takeDamage(3);
+				units[i]->beRepaired(2);
+			}
+		}
+		elapsed += nowNs() - start;
+		for (int i = 0; i < UNITS; i++)
+			delete units[i];
+	}
+	report("brawl ClapTrap* (virtual)", elapsed, (size_t)REPETITIONS * ROUNDS * UNITS * 3);
+}
+
+static void	brawlStatic(const std::string& target) {
+
+	uint64_t	elapsed = 0;
+
+	for (int rep = 0; rep < REPETITIONS; rep++) {
+		std::vector<TrapUnit>	units;
+
+		for (int i = 0; i < UNITS; i++)
+			units.push_back(TrapUnit((e_unitKind)(i & 3), "Unit"));
+
+		const uint64_t	start = nowNs();
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (int i = 0; i < UNITS; i++) {
+				units[i].attack(target);
+				units[(i * 7 + round) % UNITS].takeDamage(3);
+				units[i].beRepaired(2);
+			}
+		}
+		elapsed += nowNs() - start;
+	}
+	report("brawl TrapUnit (tagged union)", elapsed, (size_t)REPETITIONS * ROUNDS * UNITS * 3);
+}
+
+/* guardGate and highFivesGuys reach the stats through the virtual base */
+static void	diamondsVirtual(void) {
+
+	uint64_t	elapsed = 0;
+
+	for (int rep = 0; rep < REPETITIONS; rep++) {
+		std::vector<DiamondTrap*>	units;
+
+		for (int i = 0; i < UNITS; i++)
+			units.push_back(new DiamondTrap("Diamond"));
+
+		const uint64_t	start = nowNs();
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (int i = 0; i < UNITS; i++) {
+				units[i]->guardGate();
+				units[i]->highFivesGuys();
+				units[i]->whoAmI();
+			}
+		}
+		elapsed += nowNs() - start;
+		for (int i = 0; i < UNITS; i++)
+			delete units[i];
+	}
+	report("diamonds DiamondTrap*", elapsed, (size_t)REPETITIONS * ROUNDS * UNITS * 3);
+}
+
+static void	diamondsStatic(void) {
+
+	uint64_t	elapsed = 0;
+
+	for (int rep = 0; rep < REPETITIONS; rep++) {
+		std::vector<TrapUnit>	units(UNITS, TrapUnit(UNIT_DIAMONDTRAP, "Diamond"));
+		const uint64_t			start = nowNs();
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (int i = 0; i < UNITS; i++) {
+				units[i].guardGate();
+				units[i].highFivesGuys();
+				units[i].whoAmI();
+			}
+		}
+		elapsed += nowNs() - start;
+	}
+	report("diamonds TrapUnit", elapsed, (size_t)REPETITIONS * ROUNDS * UNITS * 3);
+}
+
+/* UnitArena damage then repair over every unit: one at a time, then batched */
+static void	batchArena(bool batched) {
+
+	enum { ARENA_UNITS = 1 << 16 };
+	std::vector<unsigned int>	damage(ARENA_UNITS);
+	std::vector<unsigned int>	repair(ARENA_UNITS);
+	uint64_t					elapsed = 0;
+	size_t						repaired = 0;
+
+	for (int i = 0; i < ARENA_UNITS; i++) {
+		damage[i] = (i * 37) % 41;
+		repair[i] = (i * 13) % 29;
+	}
+	for (int rep = 0; rep < REPETITIONS; rep++) {
+		UnitArena	arena;
+
+		arena.spawn(UNIT_DIAMONDTRAP, "Diamond", ARENA_UNITS);
+
+		const uint64_t	start = nowNs();
+
+		for (int round = 0; round < ROUNDS; round++) {
+			if (batched) {
+				arena.takeDamage(0, ARENA_UNITS, &damage[0]);
+				repaired += arena.beRepaired(0, ARENA_UNITS, &repair[0]);
+				continue ;
+			}
+			for (UnitId i = 0; i < ARENA_UNITS; i++)
+				arena.takeDamage(i, damage[i]);
+			for (UnitId i = 0; i < ARENA_UNITS; i++)
+				repaired += arena.beRepaired(i, repair[i]);
+		}
+		elapsed += nowNs() - start;
+	}
+	report(batched ? "damage+repair batch (SIMD)" : "damage+repair per unit", elapsed,
+		(size_t)REPETITIONS * ROUNDS * ARENA_UNITS * 2);
+	std::cout << "    (" << repaired << " repairs)" << std::endl;
+}
+
+int	main(void) {
+
+	const std::string	target("Target");
+
+	EventLog::setMode(EventLog::SILENT);
+	std::cout << "== dispatch: " << UNITS << " units, " << ROUNDS << " rounds, ClapTrap " << sizeof(ClapTrap)
+		<< " B, DiamondTrap " << sizeof(DiamondTrap) << " B, TrapUnit " << sizeof(TrapUnit) << " B ==" << std::endl;
+	brawlVirtual(target);
+	brawlStatic(target);
+	diamondsVirtual();
+	diamondsStatic();
+	std::cout << "== batch: UnitArena stats ==" << std::endl;
+	batchArena(false);
+	batchArena(true);
+	return (0);
+}
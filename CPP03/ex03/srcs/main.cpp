@@ -1,7 +1,219 @@
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
+#include <sys/time.h>
+
+#include "BattleEngine.hpp"
 #include "DiamondTrap.hpp"
+#include "TrapUnit.hpp"
+#include "UnitArena.hpp"
+#include "UnitSnapshot.hpp"
+
+static double	elapsedMs(clock_t start)
+{
+	return ((double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC);
+}
+
+/* ./DiamondTrap --mass <units>: a silent brawl of the four kinds in a UnitArena */
+static int	massBattle(long units)
+{
+	static const char*	names[4] = {"Clap", "Scav", "Frag", "Diamond"};
+	UnitArena			arena;
+	clock_t				start = clock();
+
+	arena.reserve(units);
+	for (int k = 0; k < 4; k++)
+		arena.spawn((e_unitKind)k, names[k], units * (k + 1) / 4 - units * k / 4);
+	std::cout << "spawned " << arena.size() << " units in " << elapsedMs(start) << " ms" << std::endl;
+
+	size_t	strikes = 0;
+	size_t	repairs = 0;
+	int		round = 0;
+
+	start = clock();
+	for (bool acted = true; acted; round++) {
+		acted = false;
+		for (long i = 0; i < units; i++) {
+			const UnitId	target = (UnitId)((i * 7 + round * 13 + 1) % units);
+
+			if (round % 5 == 4 ? arena.beRepaired(i, 5) : arena.strike(i, target)) {
+				acted = true;
+				strikes += (round % 5 != 4);
+				repairs += (round % 5 == 4);
+			}
+		}
+	}
+
+	size_t	survivors[4] = {0, 0, 0, 0};
+
+	for (long i = 0; i < units; i++)
+		survivors[arena.kind(i)] += arena.alive(i);
+	std::cout << round << " rounds, " << strikes << " strikes, " << repairs << " repairs in "
+		<< elapsedMs(start) << " ms" << std::endl;
+	for (int k = 0; k < 4; k++)
+		std::cout << "  " << UnitArena::kindName((e_unitKind)k) << " survivors: " << survivors[k] << std::endl;
+	arena.unitState(units - 1);
+	return (0);
+}
 
-int	main(void)
+/* wall clock: clock() would add up the CPU time of every thread */
+static double	wallMs(void)
 {
+	struct timeval	now;
+
+	gettimeofday(&now, NULL);
+	return (now.tv_sec * 1000.0 + now.tv_usec / 1000.0);
+}
+
+/* ./DiamondTrap --engine <units> <threads> [ticks]: the same brawl on the BattleEngine */
+static int	tickBattle(long units, unsigned int threads, unsigned int maxTicks)
+{
+	static const char*	names[4] = {"Clap", "Scav", "Frag", "Diamond"};
+	UnitArena			arena;
+
+	arena.reserve(units);
+	for (int k = 0; k < 4; k++)
+		arena.spawn((e_unitKind)k, names[k], units * (k + 1) / 4 - units * k / 4);
+
+	BattleEngine	engine(arena, threads, 42);
+	const double	start = wallMs();
+	unsigned int	ticks = engine.run(maxTicks);
+	const double	elapsed = wallMs() - start;
+
+	std::cout << ticks << " ticks on " << engine.threads() << " threads in " << elapsed << " ms ("
+		<< (elapsed > 0 ? ticks * 1000.0 / elapsed : 0) << " ticks/s)" << std::endl;
+	std::cout << engine.strikes() << " strikes, " << engine.repairs() << " repairs, "
+		<< engine.kills() << " kills, checksum " << std::hex << engine.checksum() << std::dec << std::endl;
+	arena.unitState(units - 1);
+	return (0);
+}
+
+/*
+ * ./DiamondTrap --snapshot <units> <threads> <ticks> [path]: the battle
+ * saved halfway and played to the end, then reopened from the file in a
+ * new arena and resumed from the saved tick: both ends must be equal.
+ */
+static int	snapshotBattle(long units, unsigned int threads, unsigned int maxTicks, const std::string& path)
+{
+	static const char*	names[4] = {"Clap", "Scav", "Frag", "Diamond"};
+	UnitArena			arena;
+
+	arena.reserve(units);
+	for (int k = 0; k < 4; k++)
+		arena.spawn((e_unitKind)k, names[k], units * (k + 1) / 4 - units * k / 4);
+
+	BattleEngine	engine(arena, threads, 42);
+
+	engine.run(maxTicks / 2);
+	if (!UnitSnapshot::save(arena, path, engine.ticks())) {
+		std::cerr << "cannot save " << path << std::endl;
+		return (1);
+	}
+	std::cout << "saved tick " << engine.ticks() << " of " << arena.size() << " units to " << path << std::endl;
+	engine.run(maxTicks - engine.ticks());
+
+	const unsigned long long	played = engine.checksum();
+	UnitSnapshot				snapshot(path);
+	UnitArena					restored;
+
+	if (!snapshot.isOpen() || !snapshot.restore(restored)) {
+		std::cerr << "cannot restore " << path << std::endl;
+		return (1);
+	}
+
+	BattleEngine	resumed(restored, threads, 42);
+
+	resumed.setTick(snapshot.tick());
+	resumed.run(maxTicks - snapshot.tick());
+	std::cout << "played through: tick " << engine.ticks() << ", checksum " << std::hex << played << std::dec << std::endl;
+	std::cout << "restored at " << snapshot.tick() << ": tick " << resumed.ticks() << ", checksum "
+		<< std::hex << resumed.checksum() << std::dec << std::endl;
+	return (played == resumed.checksum() && engine.ticks() == resumed.ticks() ? 0 : 1);
+}
+
+/* a short scene touching every event kind but clapTrapState (which prints itself) */
+static void	eventScene(void)
+{
+	{
+		DiamondTrap	first;
+		DiamondTrap	second("Alice");
+		DiamondTrap	third(second);
+
+		first = third;
+		first.whoAmI();
+		second.attack("Goblin");
+		// longer than EventLog::TARGET_SIZE: interned rather than copied inline
+		second.attack("the Goblin King's entire royal guard, standing at the gate");
+		second.takeDamage(30);
+		second.beRepaired(10);
+		second.takeDamage(200);
+		second.attack("Goblin");
+		third.guardGate();
+		third.highFivesGuys();
+	}
+	{
+		ClapTrap	clap("Clap");
+		ScavTrap	scav("Scav");
+		FragTrap	frag("Frag");
+		TrapUnit	unit(UNIT_DIAMONDTRAP, "Unit");
+		TrapUnit	copy(unit);
+
+		clap.attack("Scav");
+		clap.attack(std::string(EventLog::TARGET_SIZE, 'x'));		// the longest inline target
+		scav.attack("Frag");
+		frag.attack("Clap");
+		unit.attack("Scav");
+		unit.whoAmI();
+		copy.guardGate();
+		copy.highFivesGuys();
+	}
+}
+
+/* ./DiamondTrap --events: the RECORD ring, drained and printed, must write the ECHO text */
+static int	eventCheck(void)
+{
+	std::ostringstream	echoed;
+	std::ostringstream	recorded;
+	std::streambuf*		standard = std::cout.rdbuf(echoed.rdbuf());
+
+	EventLog::setMode(EventLog::ECHO);
+	eventScene();
+
+	std::cout.rdbuf(recorded.rdbuf());
+	EventLog::setMode(EventLog::RECORD);
+	eventScene();
+	const size_t	records = EventLog::drain(EventLog::print);
+	EventLog::setMode(EventLog::ECHO);
+	std::cout.rdbuf(standard);
+
+	const bool	same = echoed.str() == recorded.str() && !echoed.str().empty();
+
+	std::cout << records << " records, " << EventLog::dropped() << " dropped, "
+		<< echoed.str().size() << " bytes echoed, " << recorded.str().size() << " bytes drained: "
+		<< (same ? "identical" : "DIFFERENT") << std::endl;
+	return (same ? 0 : 1);
+}
+
+int	main(int ac, char **av)
+{
+	const std::string	mode = ac > 1 ? av[1] : "";
+
+	if (mode == "--mass" && ac == 3)
+		return (massBattle(std::atol(av[2]) > 0 ? std::atol(av[2]) : 1));
+	if (mode == "--engine" && (ac == 4 || ac == 5))
+		return (tickBattle(std::atol(av[2]) > 0 ? std::atol(av[2]) : 1, std::atol(av[3]) > 0 ? std::atol(av[3]) : 1,
+			ac == 5 && std::atol(av[4]) > 0 ? std::atol(av[4]) : 1000000));
+	if (mode == "--snapshot" && (ac == 5 || ac == 6))
+		return (snapshotBattle(std::atol(av[2]) > 0 ? std::atol(av[2]) : 1, std::atol(av[3]) > 0 ? std::atol(av[3]) : 1,
+			std::atol(av[4]) > 0 ? std::atol(av[4]) : 1, ac == 6 ? av[5] : "battle.snapshot"));
+	if (mode == "--events" && ac == 2)
+		return (eventCheck());
+	if (ac > 1) {
+		std::cerr << "usage: " << av[0] << " [--mass <units> | --engine <units> <threads> [ticks]"
+			<< " | --snapshot <units> <threads> <ticks> [path] | --events]" << std::endl;
+		return (1);
+	}
+
 	std::cout << "=== TESTS CONSTRUCTEURS ===" << std::endl;
 	std::cout << "\n--- Constructeur par défaut ---" << std::endl;
 	DiamondTrap	diamond1;
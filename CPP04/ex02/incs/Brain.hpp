@@ -2,12 +2,32 @@
 # define BRAIN_HPP
 
 # include <string>
+# include <vector>
 
+# include "IdeaStore.hpp"
+
+/*
+ * A Brain only stores the ideas that differ from the 100 it is born with,
+ * sorted by index: the defaults are interned once for every Brain. A new
+ * Brain is sizeof(Brain), 24 bytes instead of 3200 for std::string[100],
+ * and each changed idea adds 8 bytes on the heap (more while the vector
+ * has spare capacity). A Brain that changed all its 100 ideas costs about
+ * 1 KiB: still 3x under before, not the 100x of an unchanged one.
+ */
 class Brain {
 	private:
-		std::string			_ideas[100];
+		struct Change {
+			unsigned char	index;
+			IdeaId			idea;		// in the IdeaStore
+		};
+
+		std::vector<Change>	_changes;	// sorted by index, never a default idea
+
+		static bool	_before(const Change& change, int index);
 
 	public:
+		enum { IDEAS = 100 };		// indexes 0 to IDEAS - 1
+
 		Brain(void);
 		Brain(const Brain& copy);
 
@@ -17,6 +37,8 @@ class Brain {
 
 		std::string	getIdea(int index) const;
 		void		setIdea(int index, std::string idea);
+
+		size_t		bytes(void) const;		// sizeof(Brain) and the changed ideas
 };
 
 #endif
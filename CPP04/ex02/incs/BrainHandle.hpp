@@ -0,0 +1,51 @@
+#ifndef BRAINHANDLE_HPP
+# define BRAINHANDLE_HPP
+
+# include <string>
+
+# include "Brain.hpp"
+
+/*
+ * A Brain shared copy-on-write: copying a handle only counts one more
+ * owner, the Brain itself is copied the first time one of its owners
+ * calls setIdea while others still look at it. So copying a Dog or a Cat
+ * is O(1) instead of 100 strings.
+ *
+ * The owner count is atomic: handles sharing a Brain may live in different
+ * threads. One handle is not meant to be used by two threads at once.
+ */
+class BrainHandle {
+
+	private:
+		struct Shared {
+			Brain			brain;
+			unsigned long	owners;
+
+			Shared(void);
+			Shared(const Brain& brain);
+		};
+
+		Shared*	_shared;
+
+		void	_release(void);
+
+	public:
+		BrainHandle(void);		// a new Brain, its only owner
+		BrainHandle(const BrainHandle& copy);
+
+		~BrainHandle(void);
+
+		BrainHandle&	operator=(const BrainHandle& src);
+
+		std::string		getIdea(int index) const;
+		void			setIdea(int index, std::string idea);
+
+		unsigned long	owners(void) const;		// handles sharing this Brain
+
+		// drops this owner now (the Brain goes with its last one): Dog and Cat
+		// destructors call it first, so "Brain destructor called" still comes
+		// before theirs. Only destroying or assigning the handle is valid after.
+		void			release(void);
+};
+
+#endif
@@ -2,12 +2,12 @@
 # define CAT_HPP
 
 # include "Animal.hpp"
-# include "Brain.hpp"
+# include "BrainHandle.hpp"
 
 class Cat : public Animal {
 
 	private:
-		Brain* _brainIdeas;
+		BrainHandle	_brainIdeas;
 
 	public:
 		Cat(void);
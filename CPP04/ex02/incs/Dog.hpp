@@ -2,12 +2,12 @@
 # define DOG_HPP
 
 # include "Animal.hpp"
-# include "Brain.hpp"
+# include "BrainHandle.hpp"
 
 class Dog : public Animal {
 
 	private:
-		Brain* _brainIdeas;
+		BrainHandle	_brainIdeas;
 
 	public:
 		Dog(void);
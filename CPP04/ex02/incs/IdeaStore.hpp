@@ -0,0 +1,54 @@
+#ifndef IDEASTORE_HPP
+# define IDEASTORE_HPP
+
+# include <string>
+# include <vector>
+# include <pthread.h>
+
+typedef unsigned int	IdeaId;
+
+/*
+ * Every distinct idea of the program, stored once: the text lives back to
+ * back in 64 KiB arena blocks, a Brain only keeps 4-byte IdeaIds. Ideas
+ * are never forgotten, an id stays valid until the program ends.
+ *
+ * One store for the whole program (Brains do not know each other), behind
+ * a mutex since Brains can be shared between threads (BrainHandle).
+ */
+class IdeaStore {
+
+	private:
+		struct Idea {
+			const char*		text;
+			unsigned int	size;
+			unsigned int	hash;
+		};
+
+		enum { BLOCK_SIZE = 64 * 1024 };
+
+		std::vector<char*>		_blocks;
+		size_t					_blockUsed;
+		size_t					_bytes;
+		std::vector<Idea>		_ideas;
+		std::vector<IdeaId>		_slots;		// open addressing, id + 1, 0 is empty
+		pthread_mutex_t			_lock;
+
+		IdeaStore(void);
+		IdeaStore(const IdeaStore& copy);
+		~IdeaStore(void);
+		IdeaStore&	operator=(const IdeaStore& src);
+
+		static IdeaStore&	_instance(void);
+
+		const char*	_store(const std::string& text);
+		void		_grow(void);
+
+	public:
+		static IdeaId		intern(const std::string& idea);
+		static std::string	get(IdeaId id);
+
+		static size_t		size(void);		// distinct ideas
+		static size_t		bytes(void);	// arena and index memory
+};
+
+#endif
@@ -1,13 +1,21 @@
 override SRCSDIR	:= srcs/
 override SRCS		= $(addprefix $(SRCSDIR), $(SRC))
+override BENCH_SRCS	= $(addprefix $(SRCSDIR), $(addsuffix .cpp, $(LIB) $(BENCH_MAIN)))
 
-SRC	+= $(addsuffix .cpp, $(MAIN))
+SRC	+= $(addsuffix .cpp, $(LIB) $(MAIN))
 
-override MAIN			:= \
+override LIB			:= \
 	Animal \
 	Brain \
+	BrainHandle \
 	Cat \
 	Dog \
-	main \
+	IdeaStore \
 	WrongAnimal \
 	WrongCat \
+
+override MAIN			:= \
+	main \
+
+override BENCH_MAIN		:= \
+	bench/main \
@@ -1,18 +1,32 @@
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
 #include "Brain.hpp"
 #include "colors.h"
 
-Brain::Brain(void) {
+/* The 100 ideas every Brain is born with, interned once */
+struct DefaultIdeas {
+	IdeaId	ids[Brain::IDEAS];
 
-	for (int i = 0; i < 100; i++) {
-		std::stringstream	id;
-		id << i;
-		this->_ideas[i] = "string_nb_";
-		this->_ideas[i].append(id.str());
+	DefaultIdeas(void) {
+		for (int i = 0; i < Brain::IDEAS; i++) {
+			std::stringstream	id;
+			id << i;
+			this->ids[i] = IdeaStore::intern("string_nb_" + id.str());
+		}
 	}
+};
+
+/* Function-local so that the first Brain asking interns them, wherever it is */
+static const IdeaId*	defaultIdeas(void) {
+
+	static const DefaultIdeas	defaults;
+
+	return (defaults.ids);
+}
 
+Brain::Brain(void) {
 	std::cout << YELLOW "Brain default constructor called" RESET << std::endl;
 }
 
@@ -31,25 +45,56 @@ Brain&	Brain::operator=(const Brain& src) {
 
 	std::cout << BLUE "(Brain) copy assignment operator called" RESET << std::endl;
 
-	if (this != &src) {
-		for (int i = 0; i < 100; i++) {
-			this->_ideas[i] = src._ideas[i];
-		}
-	}
+	if (this != &src)
+		this->_changes = src._changes;
 
 	return (*this);
 }
 
 std::string	Brain::getIdea(int index) const {
 
-	if (index < 0 || index >= 100)
+	if (index < 0 || index >= IDEAS)
 		return ("Out of range");
-	return (this->_ideas[index]);
+
+	std::vector<Change>::const_iterator	change
+		= std::lower_bound(this->_changes.begin(), this->_changes.end(), index, _before);
+
+	if (change != this->_changes.end() && change->index == index)
+		return (IdeaStore::get(change->idea));
+	return (IdeaStore::get(defaultIdeas()[index]));
 }
 
 void	Brain::setIdea(int index, std::string idea) {
 
-	if (index < 0 || index >= 100)
+	if (index < 0 || index >= IDEAS)
 		return ;
-	_ideas[index] = idea;
+
+	const IdeaId					id = IdeaStore::intern(idea);
+	std::vector<Change>::iterator	change
+		= std::lower_bound(this->_changes.begin(), this->_changes.end(), index, _before);
+	const bool						known = change != this->_changes.end() && change->index == index;
+
+	if (id == defaultIdeas()[index]) {		// back to the default: nothing to store
+		if (known)
+			this->_changes.erase(change);
+		return ;
+	}
+	if (known) {
+		change->idea = id;
+		return ;
+	}
+
+	Change	added;
+
+	added.index = (unsigned char)index;
+	added.idea = id;
+	this->_changes.insert(change, added);
+}
+
+size_t	Brain::bytes(void) const {
+	return (sizeof(Brain) + this->_changes.capacity() * sizeof(Change));
+}
+
+bool	Brain::_before(const Change& change, int index) {
+	return (change.index < index);
 }
@@ -0,0 +1,60 @@
+#include "BrainHandle.hpp"
+
+BrainHandle::Shared::Shared(void) : brain(), owners(1) {}
+
+BrainHandle::Shared::Shared(const Brain& brain) : brain(brain), owners(1) {}
+
+
+BrainHandle::BrainHandle(void) : _shared(new Shared()) {}
+
+BrainHandle::BrainHandle(const BrainHandle& copy) : _shared(copy._shared) {
+	__atomic_add_fetch(&this->_shared->owners, 1, __ATOMIC_RELAXED);
+}
+
+BrainHandle::~BrainHandle(void) {
+	this->_release();
+}
+
+BrainHandle&	BrainHandle::operator=(const BrainHandle& src) {
+
+	if (this->_shared != src._shared) {
+		__atomic_add_fetch(&src._shared->owners, 1, __ATOMIC_RELAXED);
+		this->_release();
+		this->_shared = src._shared;
+	}
+
+	return (*this);
+}
+
+/* The last owner deletes: acq_rel so its writes to the Brain happen before */
+void	BrainHandle::_release(void) {
+	if (this->_shared != NULL && __atomic_sub_fetch(&this->_shared->owners, 1, __ATOMIC_ACQ_REL) == 0)
+		delete this->_shared;
+}
+
+void	BrainHandle::release(void) {
+	this->_release();
+	this->_shared = NULL;
+}
+
+
+std::string	BrainHandle::getIdea(int index) const {
+	return (this->_shared->brain.getIdea(index));
+}
+
+void	BrainHandle::setIdea(int index, std::string idea) {
+
+	if (index < 0 || index >= Brain::IDEAS)
+		return ;
+	if (__atomic_load_n(&this->_shared->owners, __ATOMIC_ACQUIRE) != 1) {
+		Shared*	own = new Shared(this->_shared->brain);
+
+		this->_release();
+		this->_shared = own;
+	}
+	this->_shared->brain.setIdea(index, idea);
+}
+
+unsigned long	BrainHandle::owners(void) const {
+	return (__atomic_load_n(&this->_shared->owners, __ATOMIC_RELAXED));
+}
@@ -4,17 +4,17 @@
 #include "colors.h"
 
 
-Cat::Cat(void) : Animal("Cat"), _brainIdeas(new Brain()) {
+Cat::Cat(void) : Animal("Cat"), _brainIdeas() {
 	std::cout << YELLOW << this->_type << " default constructor called" RESET << std::endl;
 }
 
-Cat::Cat(const Cat& copyName) : Animal(copyName), _brainIdeas(new Brain(*copyName._brainIdeas)) {
+Cat::Cat(const Cat& copyName) : Animal(copyName), _brainIdeas(copyName._brainIdeas) {
 	std::cout << YELLOW << this->_type << " copy constructor called" RESET << std::endl;
 }
 
 Cat::~Cat(void) {
 
-	delete this->_brainIdeas;
+	this->_brainIdeas.release();
 
 	std::cout << this->_type << " destructor called" << std::endl;
 }
@@ -25,9 +25,7 @@ Cat&	Cat::operator=(const Cat& copyType) {
 
 	if (this != &copyType) {
 		Animal::operator=(copyType);
-		delete this->_brainIdeas;
-		this->_brainIdeas = new Brain(*copyType._brainIdeas
-		);
+		this->_brainIdeas = copyType._brainIdeas;
 	}
 
 	return (*this);
@@ -38,9 +36,9 @@ void	Cat::makeSound() const {
 }
 
 std::string	Cat::getIdea(int index) const {
-	return (this->_brainIdeas->getIdea(index));
+	return (this->_brainIdeas.getIdea(index));
 }
 
 void	Cat::setIdea(int index, std::string idea) {
-	this->_brainIdeas->setIdea(index, idea);
+	this->_brainIdeas.setIdea(index, idea);
 }
@@ -4,17 +4,17 @@
 #include "colors.h"
 
 
-Dog::Dog(void) : Animal("Dog"), _brainIdeas(new Brain()) {
+Dog::Dog(void) : Animal("Dog"), _brainIdeas() {
 	std::cout << YELLOW << this->_type << " default constructor called" RESET << std::endl;
 }
 
-Dog::Dog(const Dog& copyName) : Animal(copyName), _brainIdeas(new Brain(*copyName._brainIdeas)) {
+Dog::Dog(const Dog& copyName) : Animal(copyName), _brainIdeas(copyName._brainIdeas) {
 	std::cout << YELLOW << this->_type << " copy constructor called" RESET << std::endl;
 }
 
 Dog::~Dog(void) {
 
-	delete this->_brainIdeas;
+	this->_brainIdeas.release();
 
 	std::cout << this->_type << " destructor called" << std::endl;
 }
@@ -25,8 +25,7 @@ Dog&	Dog::operator=(const Dog& copyType) {
 
 	if (this != &copyType) {
 		Animal::operator=(copyType);
-		delete _brainIdeas;
-		this->_brainIdeas = new Brain(*copyType._brainIdeas);
+		this->_brainIdeas = copyType._brainIdeas;
 	}
 
 	return (*this);
@@ -37,9 +36,9 @@ void	Dog::makeSound() const {
 }
 
 std::string	Dog::getIdea(int index) const {
-	return (this->_brainIdeas->getIdea(index));
+	return (this->_brainIdeas.getIdea(index));
 }
 
 void	Dog::setIdea(int index, std::string idea) {
-	this->_brainIdeas->setIdea(index, idea);
+	this->_brainIdeas.setIdea(index, idea);
 }
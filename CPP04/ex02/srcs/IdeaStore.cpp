@@ -0,0 +1,144 @@
+#include <cstring>
+
+#include "IdeaStore.hpp"
+
+/* FNV-1a */
+static unsigned int	hashText(const char* text, size_t size) {
+
+	unsigned int	hash = 2166136261u;
+
+	for (size_t i = 0; i < size; i++)
+		hash = (hash ^ (unsigned char)text[i]) * 16777619u;
+	return (hash);
+}
+
+IdeaStore::IdeaStore(void) : _blockUsed(BLOCK_SIZE), _bytes(0), _slots(64, 0) {
+	pthread_mutex_init(&this->_lock, NULL);
+}
+
+IdeaStore::~IdeaStore(void) {
+
+	for (size_t i = 0; i < this->_blocks.size(); i++)
+		delete[] this->_blocks[i];
+	pthread_mutex_destroy(&this->_lock);
+}
+
+/* Function-local so that it exists before the first Brain, wherever it is */
+IdeaStore&	IdeaStore::_instance(void) {
+
+	static IdeaStore	store;
+
+	return (store);
+}
+
+
+/* Copies the text into the arena, in a block of its own when too long */
+const char*	IdeaStore::_store(const std::string& text) {
+
+	char*	at;
+
+	if (text.empty())		// nothing to copy, and maybe no block yet
+		return ("");
+
+	if (text.size() > BLOCK_SIZE / 4) {
+		at = new char[text.size()];
+		// before the block being filled, which stays last
+		this->_blocks.insert(this->_blocks.end() - (this->_blocks.empty() ? 0 : 1), at);
+		this->_bytes += text.size();
+	}
+	else {
+		if (this->_blockUsed + text.size() > BLOCK_SIZE) {
+			this->_blocks.push_back(new char[BLOCK_SIZE]);
+			this->_blockUsed = 0;
+			this->_bytes += BLOCK_SIZE;
+		}
+		at = this->_blocks.back() + this->_blockUsed;
+		this->_blockUsed += text.size();
+	}
+	memcpy(at, text.data(), text.size());
+	return (at);
+}
+
+/* Twice the slots, kept at most half full */
+void	IdeaStore::_grow(void) {
+
+	std::vector<IdeaId>	slots(this->_slots.size() * 2, 0);
+	const size_t		mask = slots.size() - 1;
+
+	for (IdeaId id = 0; id < this->_ideas.size(); id++) {
+		size_t	slot = this->_ideas[id].hash & mask;
+
+		while (slots[slot] != 0)
+			slot = (slot + 1) & mask;
+		slots[slot] = id + 1;
+	}
+	this->_slots.swap(slots);
+}
+
+
+IdeaId	IdeaStore::intern(const std::string& idea) {
+
+	IdeaStore&			store = _instance();
+	const unsigned int	hash = hashText(idea.data(), idea.size());
+
+	pthread_mutex_lock(&store._lock);
+
+	size_t	mask = store._slots.size() - 1;
+	size_t	slot = hash & mask;
+
+	for (; store._slots[slot] != 0; slot = (slot + 1) & mask) {
+		const IdeaId	id = store._slots[slot] - 1;
+		const Idea&		known = store._ideas[id];
+
+		if (known.hash == hash && known.size == idea.size() && memcmp(known.text, idea.data(), known.size) == 0) {
+			pthread_mutex_unlock(&store._lock);
+			return (id);
+		}
+	}
+
+	const IdeaId	id = store._ideas.size();
+	Idea			added;
+
+	added.text = store._store(idea);
+	added.size = idea.size();
+	added.hash = hash;
+	store._ideas.push_back(added);
+	store._slots[slot] = id + 1;
+	if (store._ideas.size() * 2 > store._slots.size())
+		store._grow();
+
+	pthread_mutex_unlock(&store._lock);
+	return (id);
+}
+
+std::string	IdeaStore::get(IdeaId id) {
+
+	IdeaStore&	store = _instance();
+
+	pthread_mutex_lock(&store._lock);
+	const Idea	idea = store._ideas[id];
+	pthread_mutex_unlock(&store._lock);
+	// the text itself never moves
+	return (std::string(idea.text, idea.size));
+}
+
+size_t	IdeaStore::size(void) {
+
+	IdeaStore&	store = _instance();
+
+	pthread_mutex_lock(&store._lock);
+	const size_t	size = store._ideas.size();
+	pthread_mutex_unlock(&store._lock);
+	return (size);
+}
+
+size_t	IdeaStore::bytes(void) {
+
+	IdeaStore&	store = _instance();
+
+	pthread_mutex_lock(&store._lock);
+	const size_t	bytes = store._bytes + store._ideas.capacity() * sizeof(Idea)
+		+ store._slots.capacity() * sizeof(IdeaId);
+	pthread_mutex_unlock(&store._lock);
+	return (bytes);
+}
@@ -0,0 +1,166 @@
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+#include "BrainHandle.hpp"
+#include "Cat.hpp"
+#include "Dog.hpp"
+
+/*
+ * ./brainBench: what copying a Cat costs, now that its Brain is shared
+ * copy-on-write, against the deep copy every Cat copy used to make.
+ * std::cout is muted during the timed parts: every constructor prints.
+ *
+ * Compare like with like: a Brain copy against a BrainHandle copy, then a
+ * whole Cat copy with each. A Cat copy is mostly the Animal and Cat
+ * constructors and destructors (four muted lines, the type string), so it
+ * costs more than a bare Brain copy whichever Brain it gets.
+ */
+
+enum { COPIES = 20000, HERD = 1000, WRITE_EVERY = 20 };
+
+static uint64_t	nowNs(void) {
+
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+static void	report(const char* name, uint64_t ns, size_t ops) {
+
+	const double	perOp = ops ? (double)ns / ops : 0.0;
+
+	std::clog << "  " << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << perOp << " ns/op" << std::setw(12) << std::setprecision(3)
+		<< (perOp > 0 ? 1000.0 / perOp : 0.0) << " Mop/s" << std::endl;
+}
+
+/* the Brain part of Cat(const Cat&) before: a new Brain(*brain) */
+static void	deepCopies(const Brain& brain) {
+
+	const uint64_t	start = nowNs();
+
+	for (int i = 0; i < COPIES; i++) {
+		Brain*	copy = new Brain(brain);
+
+		delete copy;
+	}
+	report("Brain copy (deep)", nowNs() - start, COPIES);
+}
+
+/* the Brain part of Cat(const Cat&) now */
+static void	handleCopies(const BrainHandle& handle) {
+
+	const uint64_t	start = nowNs();
+
+	for (int i = 0; i < COPIES; i++) {
+		BrainHandle	copy(handle);
+	}
+	report("BrainHandle copy (shared)", nowNs() - start, COPIES);
+}
+
+/* what Cat(const Cat&) did before: the Cat copy and its own Brain */
+static void	deepCatCopies(const Cat& cat, const Brain& brain) {
+
+	const uint64_t	start = nowNs();
+
+	for (int i = 0; i < COPIES; i++) {
+		Cat		copy(cat);
+		Brain*	own = new Brain(brain);
+
+		delete own;
+	}
+	report("Cat copy, deep Brain (before)", nowNs() - start, COPIES);
+}
+
+static void	sharedCopies(const Cat& cat) {
+
+	const uint64_t	start = nowNs();
+
+	for (int i = 0; i < COPIES; i++) {
+		Cat	copy(cat);
+	}
+	report("Cat copy, shared Brain (now)", nowNs() - start, COPIES);
+}
+
+static void	detachedCopies(const Cat& cat) {
+
+	const uint64_t	start = nowNs();
+
+	for (int i = 0; i < COPIES; i++) {
+		Cat	copy(cat);
+
+		copy.setIdea(0, "mine");
+	}
+	report("Cat copy + setIdea (Brain copied)", nowNs() - start, COPIES);
+}
+
+/* a herd copied from one Cat, every WRITE_EVERY-th one changes its mind */
+static void	herd(const Cat& cat) {
+
+	const uint64_t	start = nowNs();
+	size_t			read = 0;
+
+	for (int round = 0; round < COPIES / HERD; round++) {
+		std::vector<Cat>	cats(HERD, cat);
+
+		for (int i = 0; i < HERD; i++) {
+			if (i % WRITE_EVERY == 0)
+				cats[i].setIdea(i % Brain::IDEAS, "hungry");
+			read += cats[i].getIdea(i % Brain::IDEAS).size();
+		}
+	}
+	report("herd copies, 1 in 20 writes", nowNs() - start, COPIES);
+	std::clog << "    (" << read << " chars read)" << std::endl;
+}
+
+/* an empty idea first: the IdeaStore has no arena block yet */
+static bool	emptyIdeaFirst(void) {
+
+	Dog		dog;
+	Dog		copy(dog);
+
+	dog.setIdea(0, "");
+	copy.setIdea(1, "");
+	return (dog.getIdea(0).empty() && copy.getIdea(1).empty() && copy.getIdea(0) == "string_nb_0");
+}
+
+int	main(void) {
+
+	std::streambuf*	out = std::cout.rdbuf(NULL);
+
+	std::clog << "== empty idea before any other: " << (emptyIdeaFirst() ? "ok" : "WRONG") << " ==" << std::endl;
+
+	std::clog << "== Brain copies (" << COPIES << " each) ==" << std::endl;
+	{
+		Cat			cat;
+		Brain		brain;
+		BrainHandle	handle;
+
+		deepCopies(brain);
+		handleCopies(handle);
+		deepCatCopies(cat, brain);
+		sharedCopies(cat);
+		detachedCopies(cat);
+		herd(cat);
+	}
+
+	std::clog << "== Brain memory (" << Brain::IDEAS * sizeof(std::string) << " B as std::string[100]) ==" << std::endl;
+	{
+		Brain	changed;
+
+		std::clog << "  new Brain " << changed.bytes() << " B";
+		for (int i = 0; i < Brain::IDEAS; i++) {
+			changed.setIdea(i, "mine");
+			if (i + 1 == 10 || i + 1 == Brain::IDEAS)
+				std::clog << ", " << i + 1 << " ideas changed " << changed.bytes() << " B";
+		}
+	}
+	std::cout.rdbuf(out);
+	std::clog << std::endl << "  ideas interned: " << IdeaStore::size()
+		<< ", IdeaStore " << IdeaStore::bytes() << " B for the whole program" << std::endl;
+	return (0);
+}